@@ -0,0 +1,133 @@
+/**
+ * \file AffectationOptimale.cpp
+ * \brief Implantation de l'affectation colis → drones de coût minimal.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "AffectationOptimale.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+namespace microdrone
+{
+
+namespace
+{
+// Coût d'un couple interdit (drone trop faible ou colonne fictive). Il domine
+// toute somme de gaspillages réels, ce qui fait primer le nombre de colis servis.
+const double COUT_INTERDIT = 1e6;
+const double INFINI = numeric_limits<double>::infinity();
+}
+
+    /**
+     * \brief Affecte au plus un drone à chaque colis en minimisant le gaspillage.
+     *
+     * Si les colis sont plus nombreux que les drones, des colonnes fictives
+     * interdites complètent la matrice. L'échéance est vérifiée après chaque
+     * colis ajouté au couplage.
+     *
+     * \param[in] p_poids Le poids de chaque colis du lot.
+     * \param[in] p_chargesMax La charge utile de chaque drone candidat.
+     * \param[in] p_echeance Au-delà de cet instant, le calcul est abandonné.
+     * \param[out] p_affectation Pour chaque colis, l'indice du drone dans
+     *             p_chargesMax, ou SANS_DRONE.
+     * \return false si l'échéance a été dépassée (p_affectation est alors vide).
+     */
+bool affecterAuMoindreCout(const vector<double>& p_poids,
+                           const vector<double>& p_chargesMax,
+                           chrono::steady_clock::time_point p_echeance,
+                           vector<size_t>& p_affectation)
+{
+    const size_t n = p_poids.size();
+    const size_t nbDrones = p_chargesMax.size();
+    const size_t m = max(n, nbDrones);
+    p_affectation.assign(n, SANS_DRONE);
+    if (n == 0)
+        return true;
+
+    auto cout = [&](size_t p_colis, size_t p_drone)
+    {
+        if (p_drone >= nbDrones || p_chargesMax[p_drone] < p_poids[p_colis])
+            return COUT_INTERDIT;
+        return p_chargesMax[p_drone] - p_poids[p_colis];
+    };
+
+    // Potentiels et couplage, indicés à partir de 1 (0 est la colonne fictive de départ).
+    vector<double> u(n + 1, 0.0);
+    vector<double> v(m + 1, 0.0);
+    vector<size_t> ligneDeColonne(m + 1, 0);
+    vector<size_t> precedent(m + 1, 0);
+    vector<double> minColonne(m + 1);
+    vector<char> visitee(m + 1);
+
+    for (size_t ligne = 1; ligne <= n; ++ligne)
+    {
+        ligneDeColonne[0] = ligne;
+        size_t colonne = 0;
+        fill(minColonne.begin(), minColonne.end(), INFINI);
+        fill(visitee.begin(), visitee.end(), 0);
+        do
+        {
+            visitee[colonne] = 1;
+            size_t ligneCourante = ligneDeColonne[colonne];
+            double delta = INFINI;
+            size_t suivante = 0;
+            for (size_t j = 1; j <= m; ++j)
+            {
+                if (visitee[j])
+                    continue;
+                double reduit = cout(ligneCourante - 1, j - 1) - u[ligneCourante] - v[j];
+                if (reduit < minColonne[j])
+                {
+                    minColonne[j] = reduit;
+                    precedent[j] = colonne;
+                }
+                if (minColonne[j] < delta)
+                {
+                    delta = minColonne[j];
+                    suivante = j;
+                }
+            }
+            for (size_t j = 0; j <= m; ++j)
+            {
+                if (visitee[j])
+                {
+                    u[ligneDeColonne[j]] += delta;
+                    v[j] -= delta;
+                }
+                else
+                {
+                    minColonne[j] -= delta;
+                }
+            }
+            colonne = suivante;
+        } while (ligneDeColonne[colonne] != 0);
+
+        // Inverse le chemin augmentant.
+        do
+        {
+            size_t avant = precedent[colonne];
+            ligneDeColonne[colonne] = ligneDeColonne[avant];
+            colonne = avant;
+        } while (colonne != 0);
+
+        if (chrono::steady_clock::now() > p_echeance)
+        {
+            p_affectation.clear();
+            return false;
+        }
+    }
+
+    for (size_t j = 1; j <= m; ++j)
+    {
+        size_t ligne = ligneDeColonne[j];
+        if (ligne != 0 && j <= nbDrones && cout(ligne - 1, j - 1) < COUT_INTERDIT)
+            p_affectation[ligne - 1] = j - 1;
+    }
+    return true;
+}
+
+} // namespace microdrone
@@ -0,0 +1,35 @@
+/**
+ * \file AffectationOptimale.h
+ * \brief Déclaration de l'affectation colis → drones de coût minimal.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef AFFECTATIONOPTIMALE_H_DEJA_INCLU
+#define AFFECTATIONOPTIMALE_H_DEJA_INCLU
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace microdrone
+{
+
+const std::size_t SANS_DRONE = static_cast<std::size_t>(-1); //!< Colis laissé sans drone.
+
+/**
+ * \brief Calcule l'affectation de coût minimal d'un lot de colis à des drones.
+ *
+ * Le coût d'un couple (colis, drone) est la charge utile gaspillée,
+ * chargeMax - poids; un drone trop faible est interdit. L'affectation
+ * maximise d'abord le nombre de colis servis, puis minimise le gaspillage
+ * total (méthode hongroise, O(n² m) pour n colis et m drones).
+ */
+bool affecterAuMoindreCout(const std::vector<double>& p_poids,
+                           const std::vector<double>& p_chargesMax,
+                           std::chrono::steady_clock::time_point p_echeance,
+                           std::vector<std::size_t>& p_affectation);
+
+} // namespace microdrone
+
+#endif // AFFECTATIONOPTIMALE_H_DEJA_INCLU
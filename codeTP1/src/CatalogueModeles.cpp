@@ -0,0 +1,64 @@
+/**
+ * \file CatalogueModeles.cpp
+ * \brief Implantation du catalogue des capacités par modèle de drone.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "CatalogueModeles.h"
+#include "ContratException.h"
+#include "TableChaines.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+void CatalogueModeles::vider()
+{
+    m_rangParModele.clear();
+    m_capacites.clear();
+}
+
+    /**
+     * \brief Ajoute les capacités d'un modèle.
+     *
+     * \param[in] p_modele Identifiant du modèle dans TableChaines.
+     * \param[in] p_capacite Ses capacités.
+     * \return false si le modèle était déjà au catalogue (il n'est pas modifié).
+     *
+     * \pre p_modele != TableChaines::VIDE
+     * \pre p_capacite.chargeMax > 0.0
+     */
+bool CatalogueModeles::ajouter(uint32_t p_modele, const CapaciteModele& p_capacite)
+{
+    PRECONDITION(p_modele != TableChaines::VIDE);
+    PRECONDITION(p_capacite.chargeMax > 0.0);
+    if (p_modele >= m_rangParModele.size())
+        m_rangParModele.resize(size_t(p_modele) + 1, 0);
+    if (m_rangParModele[p_modele] != 0)
+        return false;
+    m_capacites.push_back(p_capacite);
+    m_rangParModele[p_modele] = static_cast<uint32_t>(m_capacites.size());
+    return true;
+}
+
+    /**
+     * \brief Consulte les capacités d'un modèle en O(1).
+     *
+     * \param[in] p_modele Identifiant du modèle dans TableChaines.
+     * \return Les capacités, ou nullptr si le modèle n'est pas au catalogue.
+     */
+const CapaciteModele* CatalogueModeles::trouver(uint32_t p_modele) const
+{
+    if (p_modele >= m_rangParModele.size() || m_rangParModele[p_modele] == 0)
+        return nullptr;
+    return &m_capacites[m_rangParModele[p_modele] - 1];
+}
+
+size_t CatalogueModeles::taille() const
+{
+    return m_capacites.size();
+}
+
+} // namespace microdrone
@@ -0,0 +1,66 @@
+/**
+ * \file CatalogueModeles.h
+ * \brief Déclaration du catalogue des capacités par modèle de drone.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef CATALOGUEMODELES_H_DEJA_INCLU
+#define CATALOGUEMODELES_H_DEJA_INCLU
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace microdrone
+{
+
+/**
+ * \brief Capacités d'un modèle de drone.
+ */
+struct CapaciteModele
+{
+    double chargeMax;   //!< Charge utile maximale en kg.
+    double vitesse;     //!< Vitesse de croisière en km/h.
+    double autonomie;   //!< Autonomie de la batterie en minutes de vol.
+    double rotation;    //!< Temps au sol entre deux sorties, en minutes.
+};
+
+/**
+ * \class CatalogueModeles
+ * \brief Capacités des modèles, indexées par l'identifiant interné du modèle.
+ *
+ * L'identifiant du modèle (TableChaines) désigne directement une case d'un
+ * tableau : la consultation coûte O(1), sans hachage ni comparaison de chaînes.
+ */
+class CatalogueModeles
+{
+public:
+    /**
+     * \brief Retire tous les modèles.
+     */
+    void vider();
+
+    /**
+     * \brief Ajoute un modèle; retourne false s'il est déjà connu.
+     */
+    bool ajouter(std::uint32_t p_modele, const CapaciteModele& p_capacite);
+
+    /**
+     * \brief Retourne les capacités d'un modèle, ou nullptr s'il est inconnu.
+     */
+    const CapaciteModele* trouver(std::uint32_t p_modele) const;
+
+    /**
+     * \brief Retourne le nombre de modèles connus.
+     */
+    std::size_t taille() const;
+
+private:
+    std::vector<std::uint32_t> m_rangParModele;   //!< Identifiant → rang + 1 dans m_capacites (0 : inconnu).
+    std::vector<CapaciteModele> m_capacites;      //!< Capacités, dans l'ordre d'ajout.
+};
+
+} // namespace microdrone
+
+#endif // CATALOGUEMODELES_H_DEJA_INCLU
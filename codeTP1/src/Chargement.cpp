@@ -0,0 +1,89 @@
+/**
+ * \file Chargement.cpp
+ * \brief Implantation du manifeste de chargement d'un drone.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "Chargement.h"
+#include "Colis.h"
+#include "ContratException.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+const size_t Chargement::CAPACITE;
+
+Chargement::Chargement():m_colis(), m_taille(0)
+{
+}
+
+    /**
+     * \brief Ajoute un colis à la fin du chargement.
+     *
+     * \param[in] p_colis Le colis, qui doit survivre au chargement.
+     *
+     * \pre !estPlein()
+     */
+void Chargement::ajouter(const Colis& p_colis)
+{
+    PRECONDITION(!estPlein());
+    m_colis[m_taille++] = &p_colis;
+}
+
+void Chargement::vider()
+{
+    m_taille = 0;
+}
+
+size_t Chargement::taille() const
+{
+    return m_taille;
+}
+
+bool Chargement::estVide() const
+{
+    return m_taille == 0;
+}
+
+bool Chargement::estPlein() const
+{
+    return m_taille == CAPACITE;
+}
+
+    /**
+     * \brief Additionne les poids des colis, dans l'ordre d'ajout.
+     *
+     * Le total est recalculé à chaque appel (au plus CAPACITE colis) : le
+     * planificateur et les invariants obtiennent ainsi exactement la même valeur.
+     */
+double Chargement::reqPoidsTotal() const
+{
+    double total = 0.0;
+    for (const Colis* colis : *this)
+        total += colis->reqPoids();
+    return total;
+}
+
+    /**
+     * \pre p_position < taille()
+     */
+const Colis& Chargement::operator[](size_t p_position) const
+{
+    PRECONDITION(p_position < m_taille);
+    return *m_colis[p_position];
+}
+
+const Colis* const* Chargement::begin() const
+{
+    return m_colis.data();
+}
+
+const Colis* const* Chargement::end() const
+{
+    return m_colis.data() + m_taille;
+}
+
+} // namespace microdrone
@@ -0,0 +1,85 @@
+/**
+ * \file Chargement.h
+ * \brief Déclaration du manifeste de chargement d'un drone.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef CHARGEMENT_H_DEJA_INCLU
+#define CHARGEMENT_H_DEJA_INCLU
+
+#include <array>
+#include <cstddef>
+
+namespace microdrone
+{
+
+class Colis;
+
+/**
+ * \class Chargement
+ * \brief Colis emportés ensemble par un drone, rangés dans un tableau de taille fixe.
+ *
+ * Le manifeste ne possède pas les colis : ils appartiennent au catalogue du
+ * gestionnaire. Sa capacité fixe évite toute allocation, ce qui permet de le
+ * ranger tel quel dans les tableaux de FlotteSoA.
+ */
+class Chargement
+{
+public:
+    static const std::size_t CAPACITE = 8; //!< Nombre maximal de colis par sortie.
+
+    /**
+     * \brief Construit un chargement vide.
+     */
+    Chargement();
+
+    /**
+     * \brief Ajoute un colis au chargement.
+     */
+    void ajouter(const Colis& p_colis);
+
+    /**
+     * \brief Retire tous les colis.
+     */
+    void vider();
+
+    /**
+     * \brief Retourne le nombre de colis.
+     */
+    std::size_t taille() const;
+
+    /**
+     * \brief Indique si le chargement ne contient aucun colis.
+     */
+    bool estVide() const;
+
+    /**
+     * \brief Indique si le chargement a atteint CAPACITE colis.
+     */
+    bool estPlein() const;
+
+    /**
+     * \brief Retourne la somme des poids des colis.
+     */
+    double reqPoidsTotal() const;
+
+    /**
+     * \brief Retourne le colis de position p_position.
+     */
+    const Colis& operator[](std::size_t p_position) const;
+
+    /**
+     * \brief Parcours des colis dans l'ordre d'ajout.
+     */
+    const Colis* const* begin() const;
+    const Colis* const* end() const;
+
+private:
+    std::array<const Colis*, CAPACITE> m_colis;  //!< Colis, dans l'ordre d'ajout.
+    std::size_t m_taille;                        //!< Nombre de colis.
+};
+
+} // namespace microdrone
+
+#endif // CHARGEMENT_H_DEJA_INCLU
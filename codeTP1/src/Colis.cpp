@@ -9,6 +9,7 @@
 #include <sstream>
 #include <stdexcept>
 #include "ContratException.h"
+#include "TableChaines.h"
 
 using namespace std;
 
@@ -18,8 +19,8 @@ namespace microdrone
 /**
 * \brief classe du constructeur "Colis"
 */
-Colis::Colis(int p_id, double p_poids, const string& p_destination):
-    m_id(p_id), m_poids(p_poids), m_dest(p_destination)
+Colis::Colis(int p_id, double p_poids, string_view p_destination):
+    m_id(p_id), m_poids(p_poids), m_dest(TableChaines::instance().interner(p_destination))
 {
     PRECONDITION(p_id>0);
     PRECONDITION(p_poids>0.0);
@@ -27,6 +28,20 @@ Colis::Colis(int p_id, double p_poids, const string& p_destination):
     verifieInvariant();
 }
 
+/**
+* \brief Constructeur d'un colis dont la destination est déjà internée.
+*
+* \pre p_destination != TableChaines::VIDE
+*/
+Colis::Colis(int p_id, double p_poids, uint32_t p_destination):
+    m_id(p_id), m_poids(p_poids), m_dest(p_destination)
+{
+    PRECONDITION(p_id>0);
+    PRECONDITION(p_poids>0.0);
+    PRECONDITION(p_destination != TableChaines::VIDE);
+    verifieInvariant();
+}
+
 /**
 * \brief classe Invariant
 */
@@ -34,7 +49,7 @@ void Colis::verifieInvariant() const
 {
     INVARIANT(m_id > 0);
     INVARIANT(m_poids > 0.0);
-    INVARIANT(!m_dest.empty());
+    INVARIANT(m_dest != TableChaines::VIDE);
 }
 
     /**
@@ -55,7 +70,7 @@ string Colis::reqDescription() const
     ostringstream oss;
     oss << "Colis ID: " << m_id
     << ", Poids: " << m_poids << "kg "
-    <<", destination: " << m_dest;
+    <<", destination: " << reqDestination();
     return oss.str();
 }
 
@@ -70,9 +85,18 @@ double Colis::reqPoids() const
 
     /**
      * \brief Retourne la destination du colis.
-     * \return La destination sous forme de chaîne de caractères.
+     * \return Une vue sur la destination internée, valide jusqu'à la fin du programme.
+     */
+string_view Colis::reqDestination() const
+{
+    return TableChaines::instance().reqChaine(m_dest);
+}
+
+    /**
+     * \brief Retourne l'identifiant de la destination.
+     * \return L'identifiant de la destination dans TableChaines.
      */
-string Colis::reqDestination() const
+uint32_t Colis::reqIdDestination() const
 {
     return m_dest;
 }
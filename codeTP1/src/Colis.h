@@ -9,6 +9,8 @@
 #define COLIS_H_DEJA_INCLU
 
 #include <string>
+#include <string_view>
+#include <cstdint>
 #include "ContratException.h"
 
 namespace microdrone
@@ -26,7 +28,14 @@ public:
      */
     Colis(int p_id,
           double p_poids,
-          const std::string& p_destination);
+          std::string_view p_destination);
+
+    /**
+     * \brief Constructeur d'un colis dont la destination est déjà internée.
+     */
+    Colis(int p_id,
+          double p_poids,
+          std::uint32_t p_destination);
     
           
     /**
@@ -52,12 +61,17 @@ public:
     /**
      * \brief Retourne la destination du colis.
      */
-    std::string reqDestination() const;
+    std::string_view reqDestination() const;
+
+    /**
+     * \brief Retourne l'identifiant de la destination dans TableChaines.
+     */
+    std::uint32_t reqIdDestination() const;
 
 private:
     int m_id;                 //!< Identifiant du colis.
     double m_poids;           //!< Poids en kg.
-    std::string m_dest;       //!< Adresse de destination.
+    std::uint32_t m_dest;     //!< Adresse de destination, identifiant dans TableChaines.
 };
 
 } // namespace microdrone
@@ -0,0 +1,90 @@
+/**
+ * \file ColisDifferes.cpp
+ * \brief Implantation de la réserve des colis différés.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "ColisDifferes.h"
+#include <cmath>
+#include "ContratException.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+const size_t ColisDifferes::AUCUN = static_cast<size_t>(-1);
+const double ColisDifferes::PAS_TRANCHE = 0.1;
+
+namespace
+{
+// Numéro de tranche : la tranche k contient les poids de ](k-1)·PAS, k·PAS].
+long numeroTranche(double p_poids)
+{
+    return static_cast<long>(ceil(p_poids / ColisDifferes::PAS_TRANCHE));
+}
+}
+
+    /**
+     * \brief Met un colis de côté à la fin de sa tranche de poids.
+     *
+     * \param[in] p_rangColis Le rang du colis dans le catalogue.
+     * \param[in] p_poids Le poids du colis.
+     *
+     * \pre p_poids > 0.0
+     */
+void ColisDifferes::ajouter(size_t p_rangColis, double p_poids)
+{
+    PRECONDITION(p_poids > 0.0);
+    m_tranches[numeroTranche(p_poids)].emplace_back(p_rangColis, p_poids);
+    ++m_taille;
+}
+
+    /**
+     * \brief Cherche le colis le plus lourd qu'un drone peut porter.
+     *
+     * Les tranches sont visitées de la plus lourde admissible à la plus légère;
+     * dans une tranche, seul le plus ancien colis est considéré, ce qui garde
+     * l'ordre d'arrivée et un coût O(log t) pour t tranches non vides.
+     *
+     * \param[in] p_chargeMax La charge utile du drone libéré.
+     * \return Le rang du colis retiré, ou AUCUN.
+     */
+size_t ColisDifferes::extraire(double p_chargeMax)
+{
+    auto it = m_tranches.upper_bound(numeroTranche(p_chargeMax));
+    while (it != m_tranches.begin())
+    {
+        --it;
+        Tranche& tranche = it->second;
+        if (tranche.front().second <= p_chargeMax)
+        {
+            size_t rang = tranche.front().first;
+            tranche.pop_front();
+            if (tranche.empty())
+                m_tranches.erase(it);
+            --m_taille;
+            return rang;
+        }
+    }
+    return AUCUN;
+}
+
+void ColisDifferes::vider()
+{
+    m_tranches.clear();
+    m_taille = 0;
+}
+
+size_t ColisDifferes::taille() const
+{
+    return m_taille;
+}
+
+bool ColisDifferes::estVide() const
+{
+    return m_taille == 0;
+}
+
+} // namespace microdrone
@@ -0,0 +1,68 @@
+/**
+ * \file ColisDifferes.h
+ * \brief Déclaration de la réserve des colis différés, rangés par tranche de poids.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef COLISDIFFERES_H_DEJA_INCLU
+#define COLISDIFFERES_H_DEJA_INCLU
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <utility>
+
+namespace microdrone
+{
+
+/**
+ * \class ColisDifferes
+ * \brief Colis mis de côté faute de drone capable, en attente d'un retour de drone.
+ *
+ * Les colis sont rangés par tranche de poids de PAS_TRANCHE kg, chaque
+ * tranche gardant l'ordre d'arrivée. Quand un drone se libère, on lui donne
+ * le colis le plus lourd qu'il peut porter, ce qui réserve les gros porteurs
+ * aux colis qui en ont besoin.
+ */
+class ColisDifferes
+{
+public:
+    static const std::size_t AUCUN;    //!< Rang retourné quand aucun colis ne convient.
+    static const double PAS_TRANCHE;   //!< Largeur d'une tranche de poids en kg.
+
+    /**
+     * \brief Met un colis de côté.
+     */
+    void ajouter(std::size_t p_rangColis, double p_poids);
+
+    /**
+     * \brief Retire et retourne le colis le plus lourd que peut porter un drone.
+     */
+    std::size_t extraire(double p_chargeMax);
+
+    /**
+     * \brief Retire tous les colis.
+     */
+    void vider();
+
+    /**
+     * \brief Retourne le nombre de colis différés.
+     */
+    std::size_t taille() const;
+
+    /**
+     * \brief Indique s'il n'y a aucun colis différé.
+     */
+    bool estVide() const;
+
+private:
+    typedef std::deque<std::pair<std::size_t, double>> Tranche; //!< (rang du colis, poids), ordre FIFO.
+
+    std::map<long, Tranche> m_tranches;  //!< Tranches non vides, par borne supérieure.
+    std::size_t m_taille = 0;            //!< Nombre total de colis.
+};
+
+} // namespace microdrone
+
+#endif // COLISDIFFERES_H_DEJA_INCLU
@@ -0,0 +1,235 @@
+/**
+ * \file CompterAllocations.cpp
+ * \brief Vérifie que la planification et le lancement des missions n'allouent pas de mémoire.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : CompterAllocations [drones] [colis]
+ *
+ * L'outil remplace operator new par une version qui compte les allocations
+ * et les octets alloués. Il charge un scénario généré puis reçoit autant de
+ * colis par ajouterColis, et rapporte les allocations et les octets par colis
+ * de ces deux étapes; le coût du chargement de la flotte seule en est retranché. Il fait ensuite un premier tour complet (planification,
+ * lancement, fin de chaque mission) pour que les conteneurs atteignent leur
+ * taille de croisière, puis compte les allocations des tours suivants, étape
+ * par étape. Le code de retour est 1 si planifierMissions, lancerMission ou
+ * lancerMissions a alloué, ou si le chargement ou ajouterColis dépasse
+ * MAX_ALLOCATIONS_PAR_COLIS ou MAX_OCTETS_PAR_COLIS.
+ */
+#include "Gestionnaire.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+atomic<size_t> nbAllocations(0);
+atomic<size_t> nbOctets(0);
+
+void* allouer(size_t p_taille)
+{
+    nbAllocations.fetch_add(1, memory_order_relaxed);
+    nbOctets.fetch_add(p_taille, memory_order_relaxed);
+    if (void* bloc = malloc(p_taille == 0 ? 1 : p_taille))
+        return bloc;
+    throw bad_alloc();
+}
+}
+
+void* operator new(size_t p_taille)
+{
+    return allouer(p_taille);
+}
+
+void* operator new[](size_t p_taille)
+{
+    return allouer(p_taille);
+}
+
+void operator delete(void* p_bloc) noexcept
+{
+    free(p_bloc);
+}
+
+void operator delete[](void* p_bloc) noexcept
+{
+    free(p_bloc);
+}
+
+void operator delete(void* p_bloc, size_t) noexcept
+{
+    free(p_bloc);
+}
+
+void operator delete[](void* p_bloc, size_t) noexcept
+{
+    free(p_bloc);
+}
+
+namespace
+{
+// Bornes par colis reçu : les conteneurs croissent par blocs ou par doublement,
+// sans allocation propre à chaque colis, qui donnerait plus d'une allocation par colis.
+const double MAX_ALLOCATIONS_PAR_COLIS = 0.5;
+const double MAX_OCTETS_PAR_COLIS = 256.0;
+
+string genererScenario(int p_nbDrones, int p_nbColis)
+{
+    const string nomFichier = "CompterAllocations.scenario.txt";
+    ofstream fichier(nomFichier);
+    fichier << "MODELE QuadX-100 2.0 50 30 10\nMODELE Hexa-500 3.0 40 25 15\n";
+    for (int id = 1; id <= p_nbDrones; ++id)
+        fichier << "DRONE " << id << (id % 2 ? " QuadX-100\n" : " Hexa-500\n");
+    for (int id = 1; id <= p_nbColis; ++id)
+        fichier << "COLIS " << id << ' ' << 0.1 + (id % 25) * 0.1 << " Destination numéro " << id % 97 << '\n';
+    return nomFichier;
+}
+
+struct Bilan
+{
+    size_t planification = 0;
+    size_t lancement = 0;
+    size_t fin = 0;
+    size_t nbMissions = 0;
+};
+
+    /**
+     * \brief Allocations et octets alloués pendant une action.
+     */
+struct Compte
+{
+    size_t allocations = 0;
+    size_t octets = 0;
+};
+
+template <typename Action>
+Compte compter(Action p_action)
+{
+    const size_t allocations = nbAllocations.load();
+    const size_t octets = nbOctets.load();
+    p_action();
+    return Compte{nbAllocations.load() - allocations, nbOctets.load() - octets};
+}
+
+    /**
+     * \brief Allocations et octets alloués par colis reçu.
+     */
+struct Reception
+{
+    double allocations = 0.0;
+    double octets = 0.0;
+
+    Reception(const Compte& p_compte, const Compte& p_horsColis, int p_nbColis):
+        allocations((static_cast<double>(p_compte.allocations) - static_cast<double>(p_horsColis.allocations)) / p_nbColis),
+        octets((static_cast<double>(p_compte.octets) - static_cast<double>(p_horsColis.octets)) / p_nbColis)
+    {
+    }
+
+    bool estSobre() const
+    {
+        return allocations <= MAX_ALLOCATIONS_PAR_COLIS && octets <= MAX_OCTETS_PAR_COLIS;
+    }
+};
+
+    /**
+     * \brief Fait un tour : planifie, lance une mission puis les autres en lot, et les termine toutes.
+     */
+Bilan faireTour(Gestionnaire& p_gestionnaire, int p_nbDrones)
+{
+    Bilan bilan;
+    size_t avant = nbAllocations.load();
+    p_gestionnaire.planifierMissions();
+    bilan.planification = nbAllocations.load() - avant;
+
+    avant = nbAllocations.load();
+    if (p_gestionnaire.lancerMission() != nullptr)
+        bilan.nbMissions = 1 + p_gestionnaire.lancerToutesMissions();
+    bilan.lancement = nbAllocations.load() - avant;
+
+    avant = nbAllocations.load();
+    for (int id = 1; id <= p_nbDrones; ++id)
+        p_gestionnaire.terminerMission(id);
+    bilan.fin = nbAllocations.load() - avant;
+    return bilan;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 3)
+    {
+        cerr << "Utilisation : " << argv[0] << " [drones] [colis]" << endl;
+        return 2;
+    }
+    const int nbDrones = argc > 1 ? atoi(argv[1]) : 1000;
+    const int nbColis = argc > 2 ? atoi(argv[2]) : 20000;
+    if (nbDrones <= 0 || nbColis <= nbDrones)
+    {
+        cerr << "Erreur : il faut des drones et plus de colis que de drones" << endl;
+        return 2;
+    }
+
+    bool sansAllocation = true;
+    bool receptionSobre = true;
+    try
+    {
+        ostream muet(nullptr);
+        // Le coût de la flotte seule, mesuré sur un second chargement pour que
+        // les modèles soient déjà internés, est retranché du chargement complet.
+        string nomFichier = genererScenario(nbDrones, 0);
+        Compte flotte;
+        for (int essai = 0; essai < 2; ++essai)
+        {
+            Gestionnaire seul;
+            seul.definirSortie(muet);
+            flotte = compter([&] { seul.chargerScenario(nomFichier); });
+        }
+
+        nomFichier = genererScenario(nbDrones, nbColis);
+        Gestionnaire gestionnaire;
+        gestionnaire.definirSortie(muet);
+        const Reception chargement(compter([&] { gestionnaire.chargerScenario(nomFichier); }), flotte, nbColis);
+        remove(nomFichier.c_str());
+        const Reception ajout(compter([&]
+            {
+                for (int id = nbColis + 1; id <= 2 * nbColis; ++id)
+                    gestionnaire.ajouterColis(id, 0.1 + (id % 25) * 0.1, "Destination ajoutée");
+            }), Compte(), nbColis);
+        receptionSobre = chargement.estSobre() && ajout.estSobre();
+        cout << "  étape  allocations/colis  octets/colis\n" << fixed
+             << "  chargement  " << setprecision(3) << chargement.allocations << "  " << setprecision(1)
+             << chargement.octets << "\n"
+             << "  ajouterColis  " << setprecision(3) << ajout.allocations << "  " << setprecision(1)
+             << ajout.octets << "\n";
+
+        faireTour(gestionnaire, nbDrones);
+        cout << "  tour  missions  planification  lancement  fin\n";
+        for (int tour = 2; gestionnaire.reqCompteurs().colisEnAttente > 0; ++tour)
+        {
+            const Bilan bilan = faireTour(gestionnaire, nbDrones);
+            cout << "  " << tour << "  " << bilan.nbMissions << "  " << bilan.planification << "  "
+                 << bilan.lancement << "  " << bilan.fin << "\n";
+            sansAllocation = sansAllocation && bilan.planification == 0 && bilan.lancement == 0;
+        }
+        cout << (sansAllocation ? "Aucune allocation en planification ni en lancement"
+                                : "ÉCHEC : la planification ou le lancement a alloué") << "\n"
+             << (receptionSobre ? "Réception des colis sous les bornes par colis"
+                                : "ÉCHEC : la réception des colis dépasse les bornes par colis") << endl;
+    }
+    catch (const exception& e)
+    {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    return sansAllocation && receptionSobre ? 0 : 1;
+}
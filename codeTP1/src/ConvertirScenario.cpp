@@ -0,0 +1,41 @@
+/**
+ * \file ConvertirScenario.cpp
+ * \brief Outil de conversion d'un scénario texte vers le format binaire.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : ConvertirScenario <scenario.txt> <scenario.bin>
+ */
+#include "LecteurScenario.h"
+#include "ScenarioBinaire.h"
+#include <exception>
+#include <iostream>
+
+using namespace std;
+using namespace microdrone;
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        cerr << "Utilisation : " << argv[0] << " <scenario.txt> <scenario.bin>" << endl;
+        return 2;
+    }
+
+    try
+    {
+        LecteurScenario lecteur(argv[1]);
+        lecteur.analyser(0);
+        ecrireScenarioBinaire(argv[2], lecteur.reqModeles(), lecteur.reqDrones(), lecteur.reqColis());
+        cout << "Scénario converti : " << lecteur.reqModeles().size() << " modèles, "
+             << lecteur.reqDrones().size() << " drones et "
+             << lecteur.reqColis().size() << " colis" << endl;
+    }
+    catch (const exception& e)
+    {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
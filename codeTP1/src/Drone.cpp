@@ -10,6 +10,7 @@
 #include <sstream>
 #include <stdexcept>
 #include "ContratException.h"
+#include "TableChaines.h"
 
 using namespace std;
 
@@ -27,7 +28,7 @@ namespace microdrone
      * \pre !p_modele.empty()
      * \pre p_chargeMax > 0.0
      */
-    Drone::Drone(int p_id, const string& p_modele, double p_chargeMax):m_id(p_id), m_modele(p_modele), m_chargeMax(p_chargeMax),m_etat(DroneEtat::LIBRE), m_colisActuel(nullptr)
+    Drone::Drone(int p_id, string_view p_modele, double p_chargeMax):m_id(p_id), m_modele(TableChaines::instance().interner(p_modele)), m_chargeMax(p_chargeMax),m_etat(DroneEtat::LIBRE), m_chargement()
 {
     PRECONDITION(p_id > 0);
     PRECONDITION(!p_modele.empty());
@@ -38,19 +39,40 @@ namespace microdrone
     /**
     * \brief Fait emporter un colis par le drone et change l’état du drone.
     *
+    * Le drone ne fait que référer au colis : celui-ci doit rester valide
+    * jusqu'à l'appel de livrer().
+    *
     * \pre estDisponible() == true
-    * \pre p_colis != nullptr
-    * \pre p_colis->reqPoids() <= m_chargeMax
+    * \pre p_colis.reqPoids() <= m_chargeMax
     *
     * \post m_etat == EN_VOL
     */
 
-void Drone::emporter(const std::shared_ptr<Colis>& p_colis)
+void Drone::emporter(const Colis& p_colis)
+{
+    PRECONDITION(estDisponible());
+    PRECONDITION(p_colis.reqPoids() <= m_chargeMax);
+    m_chargement.vider();
+    m_chargement.ajouter(p_colis);
+    m_etat = DroneEtat::EN_VOL;
+    verifieInvariant();
+}
+
+    /**
+    * \brief Fait emporter tout un chargement en une seule sortie.
+    *
+    * \pre estDisponible() == true
+    * \pre !p_chargement.estVide()
+    * \pre p_chargement.reqPoidsTotal() <= m_chargeMax
+    *
+    * \post m_etat == EN_VOL
+    */
+void Drone::emporter(const Chargement& p_chargement)
 {
     PRECONDITION(estDisponible());
-    PRECONDITION(p_colis != nullptr);
-    PRECONDITION(p_colis->reqPoids() <= m_chargeMax);
-    m_colisActuel = p_colis;
+    PRECONDITION(!p_chargement.estVide());
+    PRECONDITION(p_chargement.reqPoidsTotal() <= m_chargeMax);
+    m_chargement = p_chargement;
     m_etat = DroneEtat::EN_VOL;
     verifieInvariant();
 }
@@ -59,15 +81,15 @@ void Drone::emporter(const std::shared_ptr<Colis>& p_colis)
      * \brief Réinitialise le colis transporté et rend le drone disponible.
      *
      * \pre m_etat == DroneEtat::EN_VOL
-     * \pre m_colisActuel != nullptr
+     * \pre !m_chargement.estVide()
      *
      * \post m_etat == LIBRE
-     * \post m_colisActuel == nullptr
+     * \post m_chargement.estVide()
      */
     void Drone::livrer(){
     PRECONDITION(m_etat == DroneEtat::EN_VOL);
-    PRECONDITION(m_colisActuel != nullptr);
-    m_colisActuel = nullptr;
+    PRECONDITION(!m_chargement.estVide());
+    m_chargement.vider();
     m_etat = DroneEtat::LIBRE;
     verifieInvariant();
 }
@@ -89,14 +111,17 @@ int Drone::reqId() const
      */
 string Drone::reqDescription() const
 {
-    ostringstream oss;
-    oss << "le drone " << m_id
-    << ", modèle " << m_modele
-    << ", charge MAX = " << m_chargeMax << " kg"
-    << ", état " << (m_etat == DroneEtat::LIBRE ? "LIBRE" : "EN_VOL");
-    if (m_colisActuel != nullptr)
-        oss << ", Colis: " << m_colisActuel->reqDescription();
-    return oss.str();
+    return decrireDrone(m_id, reqModele(), m_chargeMax, m_etat, m_chargement);
+}
+
+    /**
+ * \brief Retourne le modèle du drone.
+ *
+ * \return Une vue sur le nom de modèle interné, valide jusqu'à la fin du programme.
+ */
+string_view Drone::reqModele() const
+{
+    return TableChaines::instance().reqChaine(m_modele);
 }
 
     /**
@@ -130,12 +155,20 @@ DroneEtat Drone::reqEtat() const
 }
 
     /**
-     * \brief Retourne un pointeur constant vers le colis transporté.
+     * \brief Retourne un pointeur constant vers le premier colis transporté.
      *
      * \return Le pointeur vers le colis actuel, ou nullptr si aucun colis n’est transporté.
      */
     const Colis* Drone::reqColisActuel() const{
-    return m_colisActuel.get();
+    return m_chargement.estVide() ? nullptr : &m_chargement[0];
+}
+
+    /**
+     * \brief Retourne le manifeste des colis transportés.
+     */
+const Chargement& Drone::reqChargement() const
+{
+    return m_chargement;
 }
 
 
@@ -144,20 +177,41 @@ DroneEtat Drone::reqEtat() const
  */
     void Drone::verifieInvariant() const{
     INVARIANT(m_id > 0);
-    INVARIANT(!m_modele.empty());
+    INVARIANT(m_modele != TableChaines::VIDE);
     INVARIANT(m_chargeMax > 0.0);
 
 
 
     if (m_etat == DroneEtat::EN_VOL)
     {
-        INVARIANT(m_colisActuel != nullptr);
-        INVARIANT(m_colisActuel->reqPoids() <= m_chargeMax);
+        INVARIANT(!m_chargement.estVide());
+        INVARIANT(m_chargement.reqPoidsTotal() <= m_chargeMax);
     }
     else
     {
-        INVARIANT(m_colisActuel == nullptr);
+        INVARIANT(m_chargement.estVide());
     }
 }
 
+    /**
+     * \brief Formate la description d'un drone.
+     *
+     * Partagée par Drone et DroneVue pour que les deux représentations
+     * d'un drone s'affichent de façon identique.
+     *
+     * \return Une chaîne de caractères décrivant l’état du drone.
+     */
+string decrireDrone(int p_id, string_view p_modele, double p_chargeMax,
+                    DroneEtat p_etat, const Chargement& p_chargement)
+{
+    ostringstream oss;
+    oss << "le drone " << p_id
+    << ", modèle " << p_modele
+    << ", charge MAX = " << p_chargeMax << " kg"
+    << ", état " << (p_etat == DroneEtat::LIBRE ? "LIBRE" : "EN_VOL");
+    for (const Colis* colis : p_chargement)
+        oss << ", Colis: " << colis->reqDescription();
+    return oss.str();
+}
+
 } // namespace microdrone
@@ -9,9 +9,11 @@
 #define DRONE_H_DEJA_INCLU
 
 #include <string>
+#include <string_view>
+#include <cstdint>
 #include <vector>
+#include "Chargement.h"
 #include "ContratException.h"
-#include <memory>
 
 namespace microdrone
 {
@@ -19,7 +21,7 @@ namespace microdrone
 class Colis; //!< Déclaration anticipée pour éviter l'inclusion circulaire.
 
 //! États possibles d'un drone.
-enum class DroneEtat
+enum class DroneEtat : std::uint8_t
 {
     LIBRE,       /*!< Drone disponible */
     EN_VOL       /*!< Drone en mission */
@@ -35,16 +37,21 @@ public:    /**
      * \brief Constructeur d'un drone.
      */
     Drone(int p_id,
-          const std::string& p_modele,
+          std::string_view p_modele,
           double p_chargeMax);
 
     /**
      * \brief Fait emporter un colis par le drone.
      */
-    void emporter(const std::shared_ptr<Colis>& p_colis);
+    void emporter(const Colis& p_colis);
 
     /**
-     * \brief Fait livrer le colis actuel.
+     * \brief Fait emporter plusieurs colis en une seule sortie.
+     */
+    void emporter(const Chargement& p_chargement);
+
+    /**
+     * \brief Fait livrer les colis transportés.
      */
     void livrer();
     
@@ -63,6 +70,11 @@ public:    /**
      */
     std::string reqDescription() const;
 
+    /**
+     * \brief Retourne le modèle du drone.
+     */
+    std::string_view reqModele() const;
+
     /**
      * \brief Retourne la charge utile maximale du drone.
      */
@@ -77,18 +89,29 @@ public:    /**
     DroneEtat reqEtat() const;
 
     /**
-     * \brief Retourne le colis actuellement transporté.
+     * \brief Retourne le premier colis transporté.
      */
     const Colis* reqColisActuel() const;
 
+    /**
+     * \brief Retourne le manifeste des colis transportés.
+     */
+    const Chargement& reqChargement() const;
+
 private:
     int m_id;                                 //!< Identifiant unique.
-    std::string m_modele;                     //!< Modèle du drone.
-    double m_chargeMax;                       //!< Charge utile maximale (max=2.0kg).
+    std::uint32_t m_modele;                   //!< Modèle du drone, identifiant dans TableChaines.
+    double m_chargeMax;                       //!< Charge utile maximale.
     DroneEtat m_etat;                         //!< État actuel du drone.
-    std::shared_ptr<Colis> m_colisActuel;     //!< Colis actuellement transporté (partagé).
+    Chargement m_chargement;                  //!< Colis transportés, appartenant au catalogue du gestionnaire.
 };
 
+/**
+ * \brief Formate la description d'un drone à partir de ses attributs.
+ */
+std::string decrireDrone(int p_id, std::string_view p_modele, double p_chargeMax,
+                         DroneEtat p_etat, const Chargement& p_chargement);
+
 } // namespace microdrone
 
 #endif // DRONE_H_DEJA_INCLU
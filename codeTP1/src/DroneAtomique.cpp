@@ -0,0 +1,100 @@
+/**
+ * \file DroneAtomique.cpp
+ * \brief Implantation de la classe DroneAtomique.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "DroneAtomique.h"
+#include "ContratException.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+    /**
+     * \brief Construit un drone libre.
+     *
+     * \param[in] p_id Identifiant unique du drone.
+     * \param[in] p_chargeMax Charge maximale que le drone peut emporter.
+     *
+     * \pre p_id > 0
+     * \pre p_chargeMax > 0.0
+     */
+DroneAtomique::DroneAtomique(int p_id, double p_chargeMax):m_phase(LIBRE), m_id(p_id), m_chargeMax(p_chargeMax),
+    m_missionId(0), m_colisId(0)
+{
+    PRECONDITION(p_id > 0);
+    PRECONDITION(p_chargeMax > 0.0);
+}
+
+    /**
+     * \pre Aucun autre fil n'accède à p_autre.
+     */
+DroneAtomique::DroneAtomique(DroneAtomique&& p_autre) noexcept
+    :m_phase(p_autre.m_phase.load(memory_order_relaxed)), m_id(p_autre.m_id), m_chargeMax(p_autre.m_chargeMax),
+    m_missionId(p_autre.m_missionId), m_colisId(p_autre.m_colisId)
+{
+}
+
+    /**
+     * \brief Affecte une mission au drone s'il est libre; sans effet sinon.
+     *
+     * \param[in] p_missionId L'identifiant de la mission.
+     * \param[in] p_colisId Le colis emporté.
+     * \param[in] p_poids Le poids du colis.
+     *
+     * \pre p_poids <= reqChargeMax()
+     *
+     * \return false si le drone n'était pas libre, par exemple pris par un autre fil.
+     */
+bool DroneAtomique::emporter(MissionId p_missionId, int p_colisId, [[maybe_unused]] double p_poids)
+{
+    PRECONDITION(p_poids <= m_chargeMax);
+    uint8_t attendue = LIBRE;
+    if (!m_phase.compare_exchange_strong(attendue, EMBARQUEMENT, memory_order_acquire, memory_order_relaxed))
+        return false;
+    m_missionId = p_missionId;
+    m_colisId = p_colisId;
+    m_phase.store(EN_VOL, memory_order_release);
+    return true;
+}
+
+    /**
+     * \brief Termine la mission du drone s'il est en vol et le rend libre.
+     *
+     * \param[out] p_missionId La mission terminée.
+     * \param[out] p_colisId Le colis livré.
+     *
+     * \return false si le drone n'était pas en vol, ou si un autre fil termine déjà sa mission.
+     */
+bool DroneAtomique::livrer(MissionId& p_missionId, int& p_colisId)
+{
+    uint8_t attendue = EN_VOL;
+    if (!m_phase.compare_exchange_strong(attendue, LIVRAISON, memory_order_acquire, memory_order_relaxed))
+        return false;
+    p_missionId = m_missionId;
+    p_colisId = m_colisId;
+    m_missionId = 0;
+    m_colisId = 0;
+    m_phase.store(LIBRE, memory_order_release);
+    return true;
+}
+
+int DroneAtomique::reqId() const
+{
+    return m_id;
+}
+
+double DroneAtomique::reqChargeMax() const
+{
+    return m_chargeMax;
+}
+
+DroneEtat DroneAtomique::reqEtat() const
+{
+    return m_phase.load(memory_order_acquire) == LIBRE ? DroneEtat::LIBRE : DroneEtat::EN_VOL;
+}
+
+} // namespace microdrone
@@ -0,0 +1,80 @@
+/**
+ * \file DroneAtomique.h
+ * \brief Déclaration de la classe DroneAtomique, drone partagé entre plusieurs fils.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef DRONEATOMIQUE_H_DEJA_INCLU
+#define DRONEATOMIQUE_H_DEJA_INCLU
+
+#include <atomic>
+#include <cstdint>
+#include "Drone.h"
+#include "Mission.h"
+
+namespace microdrone
+{
+
+/**
+ * \class DroneAtomique
+ * \brief Drone dont emporter et livrer sont des transitions d'état atomiques.
+ *
+ * L'état passe LIBRE → EMBARQUEMENT → EN_VOL → LIVRAISON → LIBRE. Chaque
+ * transition qui donne la main (LIBRE → EMBARQUEMENT, EN_VOL → LIVRAISON)
+ * est un compare-and-swap : un seul fil la réussit et il est alors seul à
+ * écrire ou lire la mission du drone, qu'il publie en quittant l'état
+ * transitoire. Deux planificateurs ne peuvent donc pas affecter le même
+ * drone, ni deux rapports de fin terminer deux fois la même mission.
+ * Chaque drone occupe sa propre ligne de cache.
+ */
+class alignas(64) DroneAtomique
+{
+public:
+    DroneAtomique(int p_id, double p_chargeMax);
+
+    /**
+     * \brief Déplace un drone qui n'est pas encore partagé.
+     */
+    DroneAtomique(DroneAtomique&& p_autre) noexcept;
+
+    DroneAtomique(const DroneAtomique&) = delete;
+    DroneAtomique& operator=(const DroneAtomique&) = delete;
+
+    /**
+     * \brief Affecte une mission au drone s'il est libre.
+     */
+    bool emporter(MissionId p_missionId, int p_colisId, double p_poids);
+
+    /**
+     * \brief Termine la mission du drone s'il est en vol.
+     */
+    bool livrer(MissionId& p_missionId, int& p_colisId);
+
+    int reqId() const;
+    double reqChargeMax() const;
+
+    /**
+     * \brief Retourne l'état, les états transitoires comptant comme EN_VOL.
+     */
+    DroneEtat reqEtat() const;
+
+private:
+    enum Phase : std::uint8_t
+    {
+        LIBRE,
+        EMBARQUEMENT,   // Un planificateur écrit la mission.
+        EN_VOL,
+        LIVRAISON       // Un rapport de fin lit la mission.
+    };
+
+    std::atomic<std::uint8_t> m_phase;  //!< Phase courante (voir Phase).
+    int m_id;                           //!< Identifiant unique.
+    double m_chargeMax;                 //!< Charge utile maximale.
+    MissionId m_missionId;              //!< Mission en cours (valide en EN_VOL).
+    int m_colisId;                      //!< Colis transporté (valide en EN_VOL).
+};
+
+} // namespace microdrone
+
+#endif // DRONEATOMIQUE_H_DEJA_INCLU
@@ -0,0 +1,127 @@
+/**
+ * \file FileContigue.h
+ * \brief Déclaration et implantation du gabarit FileContigue.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef FILECONTIGUE_H_DEJA_INCLU
+#define FILECONTIGUE_H_DEJA_INCLU
+
+#include <cstddef>
+#include <vector>
+#include "ContratException.h"
+
+namespace microdrone
+{
+
+/**
+ * \class FileContigue
+ * \brief File FIFO dont les éléments restent contigus en mémoire.
+ *
+ * Les éléments sont rangés dans un std::vector; retirer la tête avance
+ * simplement un curseur. L'espace libéré en tête est récupéré d'un seul
+ * bloc lorsqu'il dépasse la moitié du tableau, ce qui garde l'ajout et le
+ * retrait en O(1) amorti et permet de parcourir la file comme un tableau.
+ */
+template <typename T>
+class FileContigue
+{
+public:
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+    FileContigue():m_tete(0)
+    {
+    }
+
+    /**
+     * \brief Ajoute un élément en queue de file.
+     */
+    void ajouter(const T& p_element)
+    {
+        m_elements.push_back(p_element);
+    }
+
+    /**
+     * \brief Retourne l'élément en tête de file.
+     *
+     * \pre !estVide()
+     */
+    T& tete()
+    {
+        PRECONDITION(!estVide());
+        return m_elements[m_tete];
+    }
+
+    /**
+     * \brief Retire l'élément en tête de file.
+     *
+     * \pre !estVide()
+     */
+    void retirer()
+    {
+        PRECONDITION(!estVide());
+        ++m_tete;
+        if (m_tete == m_elements.size())
+        {
+            m_elements.clear();
+            m_tete = 0;
+        }
+        else if (m_tete >= TETE_MIN_COMPACTAGE && 2 * m_tete >= m_elements.size())
+        {
+            m_elements.erase(m_elements.begin(), m_elements.begin() + static_cast<std::ptrdiff_t>(m_tete));
+            m_tete = 0;
+        }
+    }
+
+    /**
+     * \brief Vide la file.
+     */
+    void vider()
+    {
+        m_elements.clear();
+        m_tete = 0;
+    }
+
+    /**
+     * \brief Indique si la file est vide.
+     */
+    bool estVide() const
+    {
+        return m_tete == m_elements.size();
+    }
+
+    /**
+     * \brief Retourne le nombre d'éléments dans la file.
+     */
+    std::size_t taille() const
+    {
+        return m_elements.size() - m_tete;
+    }
+
+    /**
+     * \brief Début du parcours, de la tête vers la queue.
+     */
+    const_iterator begin() const
+    {
+        return m_elements.begin() + static_cast<std::ptrdiff_t>(m_tete);
+    }
+
+    /**
+     * \brief Fin du parcours.
+     */
+    const_iterator end() const
+    {
+        return m_elements.end();
+    }
+
+private:
+    static const std::size_t TETE_MIN_COMPACTAGE = 64; //!< Retraits avant un compactage.
+
+    std::vector<T> m_elements;  //!< Éléments, y compris ceux déjà retirés avant m_tete.
+    std::size_t m_tete;         //!< Rang de la tête de file.
+};
+
+} // namespace microdrone
+
+#endif // FILECONTIGUE_H_DEJA_INCLU
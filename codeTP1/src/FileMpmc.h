@@ -0,0 +1,152 @@
+/**
+ * \file FileMpmc.h
+ * \brief Déclaration et implantation du gabarit FileMpmc.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef FILEMPMC_H_DEJA_INCLU
+#define FILEMPMC_H_DEJA_INCLU
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include "ContratException.h"
+
+namespace microdrone
+{
+
+/**
+ * \class FileMpmc
+ * \brief File FIFO bornée sans verrou, pour plusieurs producteurs et plusieurs consommateurs.
+ *
+ * Chaque case du tableau circulaire (taille puissance de deux) porte un
+ * numéro de séquence qui dit à qui elle appartient : un producteur réserve
+ * une case libre en avançant la queue par compare-and-swap, y écrit puis
+ * publie la case aux consommateurs; un consommateur fait de même avec la
+ * tête. Les producteurs ne se disputent que la queue et les consommateurs
+ * que la tête, chacune sur sa propre ligne de cache. ajouter et retirer ne
+ * bloquent jamais.
+ */
+template <typename T>
+class FileMpmc
+{
+public:
+    /**
+     * \brief Construit une file pouvant contenir p_capacite éléments.
+     *
+     * \pre p_capacite est une puissance de deux non nulle.
+     */
+    explicit FileMpmc(std::size_t p_capacite):m_cases(new Case[p_capacite]), m_capacite(p_capacite),
+        m_masque(p_capacite - 1), m_queue(0), m_tete(0)
+    {
+        PRECONDITION(p_capacite > 0 && (p_capacite & (p_capacite - 1)) == 0);
+        for (std::size_t i = 0; i < p_capacite; ++i)
+            m_cases[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    FileMpmc(const FileMpmc&) = delete;
+    FileMpmc& operator=(const FileMpmc&) = delete;
+
+    /**
+     * \brief Ajoute un élément en queue; plusieurs fils peuvent ajouter en même temps.
+     *
+     * \return false si la file est pleine; l'élément n'est pas ajouté.
+     */
+    bool ajouter(const T& p_element)
+    {
+        std::size_t position = m_queue.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Case& c = m_cases[position & m_masque];
+            const std::size_t sequence = c.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t ecart = static_cast<std::ptrdiff_t>(sequence - position);
+            if (ecart == 0)
+            {
+                if (m_queue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    c.element = p_element;
+                    c.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (ecart < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_queue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * \brief Retire l'élément de tête; plusieurs fils peuvent retirer en même temps.
+     *
+     * \return false si la file est vide.
+     */
+    bool retirer(T& p_element)
+    {
+        std::size_t position = m_tete.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Case& c = m_cases[position & m_masque];
+            const std::size_t sequence = c.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t ecart = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (ecart == 0)
+            {
+                if (m_tete.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    p_element = c.element;
+                    c.sequence.store(position + m_capacite, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (ecart < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_tete.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * \brief Retourne le nombre d'éléments, approximatif si d'autres fils modifient la file.
+     */
+    std::size_t taille() const
+    {
+        const std::size_t tete = m_tete.load(std::memory_order_relaxed);
+        const std::size_t queue = m_queue.load(std::memory_order_relaxed);
+        return queue > tete ? queue - tete : 0;
+    }
+
+    /**
+     * \brief Retourne le nombre maximal d'éléments.
+     */
+    std::size_t capacite() const
+    {
+        return m_capacite;
+    }
+
+private:
+    struct Case
+    {
+        std::atomic<std::size_t> sequence;  //!< Position attendue par le prochain accès à la case.
+        T element;
+    };
+
+    std::unique_ptr<Case[]> m_cases;                    //!< Tableau circulaire.
+    const std::size_t m_capacite;                       //!< Nombre de cases.
+    const std::size_t m_masque;                         //!< m_capacite - 1.
+
+    alignas(64) std::atomic<std::size_t> m_queue;       //!< Prochaine case réservée par un producteur.
+    alignas(64) std::atomic<std::size_t> m_tete;        //!< Prochaine case réservée par un consommateur.
+};
+
+} // namespace microdrone
+
+#endif // FILEMPMC_H_DEJA_INCLU
@@ -0,0 +1,103 @@
+/**
+ * \file FileSpsc.h
+ * \brief Déclaration et implantation du gabarit FileSpsc.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef FILESPSC_H_DEJA_INCLU
+#define FILESPSC_H_DEJA_INCLU
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include "ContratException.h"
+
+namespace microdrone
+{
+
+/**
+ * \class FileSpsc
+ * \brief File FIFO bornée sans verrou, pour un seul producteur et un seul consommateur.
+ *
+ * Les éléments sont rangés dans un tableau circulaire dont la taille est une
+ * puissance de deux. Le producteur n'écrit que la queue et le consommateur
+ * que la tête, chacun sur sa propre ligne de cache; chaque côté garde une
+ * copie de l'indice de l'autre et ne relit l'atomique que lorsque cette
+ * copie ne suffit plus. ajouter et retirer ne bloquent jamais.
+ */
+template <typename T>
+class FileSpsc
+{
+public:
+    /**
+     * \brief Construit une file pouvant contenir p_capacite éléments.
+     *
+     * \pre p_capacite est une puissance de deux non nulle.
+     */
+    explicit FileSpsc(std::size_t p_capacite):m_elements(p_capacite), m_masque(p_capacite - 1),
+        m_queue(0), m_teteConnue(0), m_tete(0), m_queueConnue(0)
+    {
+        PRECONDITION(p_capacite > 0 && (p_capacite & (p_capacite - 1)) == 0);
+    }
+
+    /**
+     * \brief Ajoute un élément en queue (producteur seulement).
+     *
+     * \return false si la file est pleine; l'élément n'est pas ajouté.
+     */
+    bool ajouter(const T& p_element)
+    {
+        const std::size_t queue = m_queue.load(std::memory_order_relaxed);
+        if (queue - m_teteConnue == m_elements.size())
+        {
+            m_teteConnue = m_tete.load(std::memory_order_acquire);
+            if (queue - m_teteConnue == m_elements.size())
+                return false;
+        }
+        m_elements[queue & m_masque] = p_element;
+        m_queue.store(queue + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * \brief Retire l'élément de tête (consommateur seulement).
+     *
+     * \return false si la file est vide.
+     */
+    bool retirer(T& p_element)
+    {
+        const std::size_t tete = m_tete.load(std::memory_order_relaxed);
+        if (tete == m_queueConnue)
+        {
+            m_queueConnue = m_queue.load(std::memory_order_acquire);
+            if (tete == m_queueConnue)
+                return false;
+        }
+        p_element = m_elements[tete & m_masque];
+        m_tete.store(tete + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * \brief Retourne le nombre maximal d'éléments.
+     */
+    std::size_t capacite() const
+    {
+        return m_elements.size();
+    }
+
+private:
+    std::vector<T> m_elements;                          //!< Tableau circulaire.
+    const std::size_t m_masque;                         //!< capacite() - 1.
+
+    alignas(64) std::atomic<std::size_t> m_queue;       //!< Prochaine case écrite (producteur).
+    std::size_t m_teteConnue;                           //!< Dernière tête lue par le producteur.
+
+    alignas(64) std::atomic<std::size_t> m_tete;        //!< Prochaine case lue (consommateur).
+    std::size_t m_queueConnue;                          //!< Dernière queue lue par le consommateur.
+};
+
+} // namespace microdrone
+
+#endif // FILESPSC_H_DEJA_INCLU
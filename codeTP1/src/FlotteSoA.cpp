@@ -0,0 +1,347 @@
+/**
+ * \file FlotteSoA.cpp
+ * \brief Implantation de FlotteSoA et de ses vues DroneVue et DroneVueConst.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "FlotteSoA.h"
+#include <algorithm>
+#include <utility>
+#include "Colis.h"
+#include "ContratException.h"
+#include "TableChaines.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+    /**
+     * \brief Construit une vue en lecture seule sur un drone de la flotte.
+     *
+     * \param[in] p_flotte La flotte.
+     * \param[in] p_rang Le rang du drone.
+     */
+DroneVueConst::DroneVueConst(const FlotteSoA& p_flotte, size_t p_rang):m_flotte(&p_flotte), m_rang(p_rang)
+{
+}
+
+    /**
+     * \brief Construit une vue sur un drone d'une flotte modifiable.
+     *
+     * \param[in] p_flotte La flotte.
+     * \param[in] p_rang Le rang du drone.
+     */
+DroneVue::DroneVue(FlotteSoA& p_flotte, size_t p_rang):DroneVueConst(p_flotte, p_rang)
+{
+}
+
+    /**
+     * \brief Retourne la flotte visée, que le constructeur a reçue modifiable.
+     */
+FlotteSoA& DroneVue::flotte() const
+{
+    return const_cast<FlotteSoA&>(*m_flotte);
+}
+
+    /**
+     * \brief Fait emporter un colis par le drone; même contrat que Drone::emporter.
+     *
+     * \pre estDisponible() == true
+     * \pre p_colis.reqPoids() <= reqChargeMax()
+     *
+     * \post reqEtat() == EN_VOL
+     */
+void DroneVue::emporter(const Colis& p_colis)
+{
+    PRECONDITION(estDisponible());
+    PRECONDITION(p_colis.reqPoids() <= reqChargeMax());
+    Chargement& chargement = flotte().m_chargements[m_rang];
+    chargement.vider();
+    chargement.ajouter(p_colis);
+    flotte().m_etats[m_rang] = DroneEtat::EN_VOL;
+    flotte().m_nbDisponibles--;
+    verifieInvariant();
+}
+
+    /**
+     * \brief Fait emporter un chargement; même contrat que Drone::emporter.
+     *
+     * \pre estDisponible() == true
+     * \pre !p_chargement.estVide()
+     * \pre p_chargement.reqPoidsTotal() <= reqChargeMax()
+     *
+     * \post reqEtat() == EN_VOL
+     */
+void DroneVue::emporter(const Chargement& p_chargement)
+{
+    PRECONDITION(estDisponible());
+    PRECONDITION(!p_chargement.estVide());
+    PRECONDITION(p_chargement.reqPoidsTotal() <= reqChargeMax());
+    flotte().m_chargements[m_rang] = p_chargement;
+    flotte().m_etats[m_rang] = DroneEtat::EN_VOL;
+    flotte().m_nbDisponibles--;
+    verifieInvariant();
+}
+
+    /**
+     * \brief Rend le drone disponible; même contrat que Drone::livrer.
+     *
+     * \pre reqEtat() == EN_VOL
+     *
+     * \post reqEtat() == LIBRE
+     * \post reqChargement().estVide()
+     */
+void DroneVue::livrer()
+{
+    PRECONDITION(reqEtat() == DroneEtat::EN_VOL);
+    PRECONDITION(!reqChargement().estVide());
+    flotte().m_chargements[m_rang].vider();
+    flotte().m_etats[m_rang] = DroneEtat::LIBRE;
+    flotte().m_nbDisponibles++;
+    verifieInvariant();
+}
+
+    /**
+     * \brief Vérifie les invariants du drone visé, comme Drone::verifieInvariant.
+     */
+void DroneVueConst::verifieInvariant() const
+{
+    INVARIANT(m_rang < m_flotte->taille());
+    INVARIANT(reqId() > 0);
+    INVARIANT(m_flotte->m_modeles[m_rang] != TableChaines::VIDE);
+    INVARIANT(reqChargeMax() > 0.0);
+    if (reqEtat() == DroneEtat::EN_VOL)
+    {
+        INVARIANT(!reqChargement().estVide());
+        INVARIANT(reqChargement().reqPoidsTotal() <= reqChargeMax());
+    }
+    else
+    {
+        INVARIANT(reqChargement().estVide());
+    }
+}
+
+int DroneVueConst::reqId() const
+{
+    return m_flotte->m_ids[m_rang];
+}
+
+string DroneVueConst::reqDescription() const
+{
+    return decrireDrone(reqId(), reqModele(), reqChargeMax(), reqEtat(), reqChargement());
+}
+
+string_view DroneVueConst::reqModele() const
+{
+    return TableChaines::instance().reqChaine(m_flotte->m_modeles[m_rang]);
+}
+
+double DroneVueConst::reqChargeMax() const
+{
+    return m_flotte->m_chargesMax[m_rang];
+}
+
+bool DroneVueConst::estDisponible() const
+{
+    return m_flotte->m_etats[m_rang] == DroneEtat::LIBRE;
+}
+
+DroneEtat DroneVueConst::reqEtat() const
+{
+    return m_flotte->m_etats[m_rang];
+}
+
+const Colis* DroneVueConst::reqColisActuel() const
+{
+    const Chargement& chargement = reqChargement();
+    return chargement.estVide() ? nullptr : &chargement[0];
+}
+
+const Chargement& DroneVueConst::reqChargement() const
+{
+    return m_flotte->m_chargements[m_rang];
+}
+
+size_t DroneVueConst::reqRang() const
+{
+    return m_rang;
+}
+
+    /**
+     * \brief Ajoute un drone libre en fin de flotte.
+     *
+     * \param[in] p_id Identifiant unique du drone (> 0).
+     * \param[in] p_modele Nom du modèle du drone (non vide).
+     * \param[in] p_chargeMax Charge utile maximale (> 0.0 kg).
+     *
+     * \pre p_id > 0
+     * \pre !p_modele.empty()
+     * \pre p_chargeMax > 0.0
+     */
+void FlotteSoA::ajouter(int p_id, string_view p_modele, double p_chargeMax)
+{
+    PRECONDITION(!p_modele.empty());
+    ajouter(p_id, TableChaines::instance().interner(p_modele), p_chargeMax);
+}
+
+    /**
+     * \brief Ajoute un drone libre en fin de flotte.
+     *
+     * \param[in] p_id Identifiant unique du drone (> 0).
+     * \param[in] p_modele Identifiant du modèle dans TableChaines.
+     * \param[in] p_chargeMax Charge utile maximale (> 0.0 kg).
+     *
+     * \pre p_id > 0
+     * \pre p_modele != TableChaines::VIDE
+     * \pre p_chargeMax > 0.0
+     */
+void FlotteSoA::ajouter(int p_id, uint32_t p_modele, double p_chargeMax)
+{
+    PRECONDITION(p_id > 0);
+    PRECONDITION(p_modele != TableChaines::VIDE);
+    PRECONDITION(p_chargeMax > 0.0);
+    m_ids.push_back(p_id);
+    m_modeles.push_back(p_modele);
+    m_chargesMax.push_back(p_chargeMax);
+    m_etats.push_back(DroneEtat::LIBRE);
+    m_chargements.emplace_back();
+    m_nbDisponibles++;
+}
+
+    /**
+     * \brief Remplace toute la flotte; les colonnes sont reprises sans copie.
+     *
+     * \param[in] p_ids Identifiants uniques des drones (> 0).
+     * \param[in] p_modeles Modèles des drones, identifiants dans TableChaines.
+     * \param[in] p_chargesMax Charges utiles maximales (> 0.0 kg).
+     *
+     * \pre Les trois colonnes ont la même taille.
+     */
+void FlotteSoA::assigner(vector<int> p_ids, vector<uint32_t> p_modeles, vector<double> p_chargesMax)
+{
+    PRECONDITION(p_ids.size() == p_modeles.size() && p_ids.size() == p_chargesMax.size());
+    m_ids = move(p_ids);
+    m_modeles = move(p_modeles);
+    m_chargesMax = move(p_chargesMax);
+    m_etats.assign(m_ids.size(), DroneEtat::LIBRE);
+    m_chargements.clear();
+    m_chargements.resize(m_ids.size());
+    m_nbDisponibles = m_ids.size();
+}
+
+    /**
+     * \brief Retire tous les drones.
+     */
+void FlotteSoA::vider()
+{
+    m_ids.clear();
+    m_modeles.clear();
+    m_chargesMax.clear();
+    m_etats.clear();
+    m_chargements.clear();
+    m_nbDisponibles = 0;
+}
+
+    /**
+     * \brief Réserve la place pour p_nb drones dans chaque tableau.
+     */
+void FlotteSoA::reserver(size_t p_nb)
+{
+    m_ids.reserve(p_nb);
+    m_modeles.reserve(p_nb);
+    m_chargesMax.reserve(p_nb);
+    m_etats.reserve(p_nb);
+    m_chargements.reserve(p_nb);
+}
+
+size_t FlotteSoA::taille() const
+{
+    return m_ids.size();
+}
+
+    /**
+     * \brief Retourne une vue sur le drone de rang p_rang.
+     *
+     * \pre p_rang < taille()
+     */
+DroneVue FlotteSoA::operator[](size_t p_rang)
+{
+    PRECONDITION(p_rang < taille());
+    return DroneVue(*this, p_rang);
+}
+
+    /**
+     * \brief Retourne une vue en lecture seule sur le drone de rang p_rang.
+     *
+     * \pre p_rang < taille()
+     */
+DroneVueConst FlotteSoA::operator[](size_t p_rang) const
+{
+    PRECONDITION(p_rang < taille());
+    return DroneVueConst(*this, p_rang);
+}
+
+FlotteSoA::iterator FlotteSoA::begin()
+{
+    return iterator(this, 0);
+}
+
+FlotteSoA::iterator FlotteSoA::end()
+{
+    return iterator(this, taille());
+}
+
+FlotteSoA::const_iterator FlotteSoA::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+FlotteSoA::const_iterator FlotteSoA::end() const
+{
+    return const_iterator(this, taille());
+}
+
+const int* FlotteSoA::reqIds() const
+{
+    return m_ids.data();
+}
+
+const uint32_t* FlotteSoA::reqModeles() const
+{
+    return m_modeles.data();
+}
+
+const double* FlotteSoA::reqChargesMax() const
+{
+    return m_chargesMax.data();
+}
+
+const DroneEtat* FlotteSoA::reqEtats() const
+{
+    return m_etats.data();
+}
+
+    /**
+     * \brief Retourne le nombre de drones libres, tenu à jour à chaque départ
+     *        et retour, en O(1).
+     */
+size_t FlotteSoA::reqNbDisponibles() const
+{
+    return m_nbDisponibles;
+}
+
+    /**
+     * \brief Compte les drones libres en parcourant le tableau des états.
+     *
+     * Sert à vérifier reqNbDisponibles en mode débogage.
+     *
+     * \return Le nombre de drones dans l'état LIBRE.
+     */
+size_t FlotteSoA::compterDisponibles() const
+{
+    return static_cast<size_t>(count(m_etats.begin(), m_etats.end(), DroneEtat::LIBRE));
+}
+
+} // namespace microdrone
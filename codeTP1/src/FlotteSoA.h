@@ -0,0 +1,236 @@
+/**
+ * \file FlotteSoA.h
+ * \brief Déclaration de la flotte rangée en tableaux parallèles et de ses vues DroneVue et DroneVueConst.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef FLOTTESOA_H_DEJA_INCLU
+#define FLOTTESOA_H_DEJA_INCLU
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Drone.h"
+
+namespace microdrone
+{
+
+class Colis;
+class FlotteSoA;
+
+/**
+ * \class DroneVueConst
+ * \brief Vue en lecture seule sur un drone de FlotteSoA, offrant les
+ *        accesseurs de la classe Drone.
+ *
+ * Une vue ne possède rien : elle désigne un rang dans la flotte. C'est ce
+ * que retournent une flotte constante et son const_iterator.
+ */
+class DroneVueConst
+{
+public:
+    /**
+     * \brief Construit une vue sur le drone de rang p_rang.
+     */
+    DroneVueConst(const FlotteSoA& p_flotte, std::size_t p_rang);
+
+    /**
+     * \brief Vérifie l'invariant du drone visé.
+     */
+    void verifieInvariant() const;
+
+    /**
+     * \brief Accesseurs équivalents à ceux de Drone.
+     */
+    int reqId() const;
+    std::string reqDescription() const;
+    std::string_view reqModele() const;
+    double reqChargeMax() const;
+    bool estDisponible() const;
+    DroneEtat reqEtat() const;
+    const Colis* reqColisActuel() const;
+    const Chargement& reqChargement() const;
+
+    /**
+     * \brief Retourne le rang du drone dans la flotte.
+     */
+    std::size_t reqRang() const;
+
+protected:
+    const FlotteSoA* m_flotte;  //!< Flotte visée.
+    std::size_t m_rang;         //!< Rang du drone dans la flotte.
+};
+
+/**
+ * \class DroneVue
+ * \brief Vue sur un drone d'une FlotteSoA modifiable, offrant l'interface de la classe Drone.
+ *
+ * Ne s'obtient que d'une flotte non constante; elle se convertit en
+ * DroneVueConst, jamais l'inverse.
+ */
+class DroneVue : public DroneVueConst
+{
+public:
+    /**
+     * \brief Construit une vue sur le drone de rang p_rang.
+     */
+    DroneVue(FlotteSoA& p_flotte, std::size_t p_rang);
+
+    /**
+     * \brief Fait emporter un colis par le drone.
+     */
+    void emporter(const Colis& p_colis);
+
+    /**
+     * \brief Fait emporter plusieurs colis en une seule sortie.
+     */
+    void emporter(const Chargement& p_chargement);
+
+    /**
+     * \brief Fait livrer les colis transportés.
+     */
+    void livrer();
+
+private:
+    FlotteSoA& flotte() const;
+};
+
+/**
+ * \class FlotteSoA
+ * \brief Flotte de drones rangée en tableaux contigus, un par attribut.
+ *
+ * Les parcours de la flotte (statistiques, recherche de drones éligibles)
+ * ne lisent ainsi que les tableaux utiles au lieu de charger des objets
+ * Drone complets dans le cache. Les drones sont désignés par leur rang;
+ * l'accès par operator[] retourne une DroneVue, ou une DroneVueConst sur
+ * une flotte constante.
+ */
+class FlotteSoA
+{
+public:
+    /**
+     * \brief Itérateur produisant des vues sur les drones successifs.
+     *
+     * Les vues sont produites par valeur : c'est un itérateur d'entrée, que
+     * les boucles for sur intervalle et les algorithmes à une passe acceptent.
+     */
+    template <typename Vue, typename Flotte>
+    class Iterateur
+    {
+    public:
+        /**
+         * \brief Résultat de operator->, qui garde la vue le temps de l'expression.
+         */
+        class Pointeur
+        {
+        public:
+            explicit Pointeur(const Vue& p_vue):m_vue(p_vue) {}
+            Vue* operator->() { return &m_vue; }
+
+        private:
+            Vue m_vue;
+        };
+
+        typedef std::input_iterator_tag iterator_category;
+        typedef Vue value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Pointeur pointer;
+        typedef Vue reference;
+
+        Iterateur(Flotte* p_flotte, std::size_t p_rang):m_flotte(p_flotte), m_rang(p_rang) {}
+        Vue operator*() const { return Vue(*m_flotte, m_rang); }
+        Pointeur operator->() const { return Pointeur(**this); }
+        Iterateur& operator++() { ++m_rang; return *this; }
+        Iterateur operator++(int) { Iterateur ancien(*this); ++m_rang; return ancien; }
+        bool operator==(const Iterateur& p_autre) const { return m_rang == p_autre.m_rang; }
+        bool operator!=(const Iterateur& p_autre) const { return m_rang != p_autre.m_rang; }
+
+    private:
+        Flotte* m_flotte;
+        std::size_t m_rang;
+    };
+
+    typedef Iterateur<DroneVue, FlotteSoA> iterator;
+    typedef Iterateur<DroneVueConst, const FlotteSoA> const_iterator;
+
+    /**
+     * \brief Ajoute un drone libre en fin de flotte.
+     */
+    void ajouter(int p_id, std::string_view p_modele, double p_chargeMax);
+
+    /**
+     * \brief Ajoute un drone libre dont le modèle est déjà interné.
+     */
+    void ajouter(int p_id, std::uint32_t p_modele, double p_chargeMax);
+
+    /**
+     * \brief Remplace toute la flotte par des drones libres, colonne par colonne.
+     */
+    void assigner(std::vector<int> p_ids, std::vector<std::uint32_t> p_modeles, std::vector<double> p_chargesMax);
+
+    /**
+     * \brief Retire tous les drones.
+     */
+    void vider();
+
+    /**
+     * \brief Réserve la place pour p_nb drones.
+     */
+    void reserver(std::size_t p_nb);
+
+    /**
+     * \brief Retourne le nombre de drones.
+     */
+    std::size_t taille() const;
+
+    /**
+     * \brief Retourne une vue sur le drone de rang p_rang.
+     */
+    DroneVue operator[](std::size_t p_rang);
+    DroneVueConst operator[](std::size_t p_rang) const;
+
+    /**
+     * \brief Parcours de la flotte par vues, dans l'ordre des rangs.
+     */
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /**
+     * \brief Accès direct aux tableaux, pour les parcours vectorisables.
+     */
+    const int* reqIds() const;
+    const std::uint32_t* reqModeles() const;
+    const double* reqChargesMax() const;
+    const DroneEtat* reqEtats() const;
+
+    /**
+     * \brief Retourne le nombre de drones libres, en O(1).
+     */
+    std::size_t reqNbDisponibles() const;
+
+    /**
+     * \brief Compte les drones libres en ne lisant que le tableau des états.
+     */
+    std::size_t compterDisponibles() const;
+
+private:
+    friend class DroneVueConst;
+    friend class DroneVue;
+
+    std::vector<int> m_ids;                    //!< Identifiants.
+    std::vector<std::uint32_t> m_modeles;      //!< Modèles (identifiants dans TableChaines).
+    std::vector<double> m_chargesMax;          //!< Charges utiles maximales.
+    std::vector<DroneEtat> m_etats;            //!< États.
+    std::vector<Chargement> m_chargements;     //!< Colis transportés (vide si aucun).
+    std::size_t m_nbDisponibles = 0;           //!< Drones dans l'état LIBRE.
+};
+
+} // namespace microdrone
+
+#endif // FLOTTESOA_H_DEJA_INCLU
@@ -0,0 +1,88 @@
+/**
+ * \file GelOperations.cpp
+ * \brief Implantation du gel des déplacements de colis.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "GelOperations.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+    /**
+     * \brief Indique qu'aucune opération n'est en cours.
+     *
+     * Un relevé sans gel garde p_commencees et le compare, après sa lecture,
+     * à commencees relu derrière une barrière d'acquisition : s'il n'a pas
+     * changé, aucune opération n'a eu lieu pendant la lecture.
+     *
+     * \param[out] p_commencees Le nombre d'opérations commencées.
+     */
+bool GelOperations::Compteur::estAuRepos(uint64_t& p_commencees) const
+{
+    p_commencees = commencees.load(memory_order_seq_cst);
+    return terminees.load(memory_order_acquire) == p_commencees;
+}
+
+    /**
+     * \brief Commence un déplacement, après la levée du gel s'il est posé.
+     *
+     * L'opération compte son début avant de lire le gel, et le relevé pose le
+     * gel avant de lire les compteurs : l'un des deux voit toujours l'autre.
+     * La barrière de libération qui suit le début assure qu'un relevé sans
+     * gel qui voit l'un des effets de l'opération voit aussi son début. Une
+     * opération suspendue se compte terminée, sans effet, puis recommence.
+     *
+     * \param[in] p_gel Le gel, ou nullptr pour ne rien compter.
+     * \param[in,out] p_compteur Le compteur d'opérations du gestionnaire.
+     */
+GelOperations::Operation::Operation(GelOperations* p_gel, Compteur& p_compteur):
+    m_compteur(p_gel != nullptr ? &p_compteur : nullptr)
+{
+    if (p_gel == nullptr)
+        return;
+    for (;;)
+    {
+        m_compteur->commencees.fetch_add(1, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_release);
+        if (!p_gel->m_pose.load(memory_order_seq_cst))
+            return;
+        m_compteur->terminees.fetch_add(1, memory_order_release);
+        p_gel->attendreLevee();
+    }
+}
+
+GelOperations::Operation::~Operation()
+{
+    if (m_compteur != nullptr)
+        m_compteur->terminees.fetch_add(1, memory_order_release);
+}
+
+GelOperations::GelOperations():m_pose(false)
+{
+}
+
+void GelOperations::poser()
+{
+    m_pose.store(true, memory_order_seq_cst);
+}
+
+void GelOperations::lever()
+{
+    {
+        lock_guard<mutex> verrou(m_verrou);
+        m_pose.store(false, memory_order_release);
+    }
+    m_levee.notify_all();
+}
+
+void GelOperations::attendreLevee()
+{
+    unique_lock<mutex> verrou(m_verrou);
+    m_levee.wait(verrou, [this]() { return !m_pose.load(memory_order_acquire); });
+}
+
+} // namespace microdrone
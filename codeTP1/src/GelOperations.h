@@ -0,0 +1,92 @@
+/**
+ * \file GelOperations.h
+ * \brief Déclaration du gel qui suspend les déplacements de colis le temps d'un relevé.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef GELOPERATIONS_H_DEJA_INCLU
+#define GELOPERATIONS_H_DEJA_INCLU
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace microdrone
+{
+
+/**
+ * \class GelOperations
+ * \brief Gel partagé par des gestionnaires dont les compteurs doivent être
+ *        relevés au même instant.
+ *
+ * Chaque déplacement d'un colis ou d'un drone d'un compteur à un autre se
+ * déclare (GelOperations::Operation) dans le Compteur de son gestionnaire :
+ * une opération commencée au début, une terminée à la fin. Un relevé lit
+ * d'abord sans rien suspendre, et se fie à sa lecture si aucun gestionnaire
+ * n'avait d'opération en cours avant et qu'aucune n'a commencé pendant.
+ * Faute d'y arriver, il pose le gel, attend que tous les gestionnaires
+ * soient au repos, lit et lève le gel; les déplacements qui arrivent pendant
+ * le gel attendent sa levée, endormis.
+ */
+class GelOperations
+{
+public:
+    /**
+     * \brief Opérations commencées et terminées d'un gestionnaire, sur leur propre ligne de cache.
+     */
+    struct alignas(64) Compteur
+    {
+        std::atomic<std::uint64_t> commencees{0};
+        std::atomic<std::uint64_t> terminees{0};
+
+        /**
+         * \brief Indique qu'aucune opération n'est en cours et donne le nombre commencé.
+         */
+        bool estAuRepos(std::uint64_t& p_commencees) const;
+    };
+
+    /**
+     * \class Operation
+     * \brief Déclare un déplacement en cours le temps de sa portée; sans effet sans gel.
+     */
+    class Operation
+    {
+    public:
+        Operation(GelOperations* p_gel, Compteur& p_compteur);
+        ~Operation();
+
+        Operation(const Operation&) = delete;
+        Operation& operator=(const Operation&) = delete;
+
+    private:
+        Compteur* m_compteur;   //!< Compteur de l'opération (nullptr : aucun gel).
+    };
+
+    GelOperations();
+
+    GelOperations(const GelOperations&) = delete;
+    GelOperations& operator=(const GelOperations&) = delete;
+
+    /**
+     * \brief Empêche les déplacements de commencer; ceux déjà commencés continuent.
+     */
+    void poser();
+
+    /**
+     * \brief Laisse reprendre les déplacements suspendus.
+     */
+    void lever();
+
+private:
+    void attendreLevee();
+
+    std::atomic<bool> m_pose;               //!< Vrai du début à la fin d'un relevé sous gel.
+    std::mutex m_verrou;                    //!< Protège l'attente de la levée.
+    std::condition_variable m_levee;        //!< Réveille les déplacements suspendus.
+};
+
+} // namespace microdrone
+
+#endif // GELOPERATIONS_H_DEJA_INCLU
@@ -0,0 +1,74 @@
+/**
+ * \file GenerateurScenario.cpp
+ * \brief Implantation du générateur de scénarios synthétiques.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "GenerateurScenario.h"
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+using namespace std;
+
+namespace microdrone
+{
+
+namespace
+{
+const char* const MODELES[] = {"QuadX-100", "Hexa-500", "Mini-200", "FastX-300"};
+const char* const DESTINATIONS[] = {"Université Laval, Pavillon Pouliot", "Centre commercial Laurier",
+                                    "Parc de la Plage-Jacques-Cartier", "Bibliothèque Gabrielle-Roy",
+                                    "Musée de la civilisation", "Hôpital Enfant-Jésus", "Cégep Limoilou",
+                                    "Aquarium du Québec"};
+}
+
+    /**
+     * \brief Écrit un scénario texte au format de data/scenario_demo.txt.
+     *
+     * Le fichier contient les quatre modèles du scénario de démonstration,
+     * puis p_nbDrones drones (un sur deux avec une charge explicite) et
+     * p_nbColis colis de 0,1 à 3 kg, identifiants à partir de 1. Une même
+     * graine donne toujours le même fichier.
+     *
+     * \param[in] p_nomFichier Le fichier écrit, remplacé s'il existe.
+     * \param[in] p_nbDrones Le nombre de drones.
+     * \param[in] p_nbColis Le nombre de colis.
+     * \param[in] p_graine La graine des poids et des destinations.
+     *
+     * \throw runtime_error si le fichier ne peut pas être écrit.
+     */
+void genererScenario(const string& p_nomFichier, size_t p_nbDrones, size_t p_nbColis, unsigned int p_graine)
+{
+    unique_ptr<FILE, int (*)(FILE*)> fichier(fopen(p_nomFichier.c_str(), "wb"), &fclose);
+    if (!fichier)
+        throw runtime_error("Impossible d'écrire le fichier " + p_nomFichier);
+
+    // fprintf plutôt qu'un ofstream : des dizaines de millions de lignes sont écrites.
+    FILE* f = fichier.get();
+    fputs("# Scénario généré\n"
+          "MODELE QuadX-100 2.0 50 30 10\n"
+          "MODELE Hexa-500 3.0 40 25 15\n"
+          "MODELE Mini-200 1.5 60 20 5\n"
+          "MODELE FastX-300 2.5 80 20 10\n", f);
+    const double charges[] = {2.0, 3.0, 1.5, 2.5};
+    for (size_t id = 1; id <= p_nbDrones; ++id)
+    {
+        const size_t modele = id % 4;
+        if (id % 2 == 0)
+            fprintf(f, "DRONE %zu %s %.1f\n", id, MODELES[modele], charges[modele]);
+        else
+            fprintf(f, "DRONE %zu %s\n", id, MODELES[modele]);
+    }
+    mt19937 generateur(p_graine);
+    uniform_int_distribution<int> dixiemes(1, 30);
+    uniform_int_distribution<size_t> destination(0, sizeof(DESTINATIONS) / sizeof(DESTINATIONS[0]) - 1);
+    for (size_t id = 1; id <= p_nbColis; ++id)
+        fprintf(f, "COLIS %zu %.1f %s\n", id, dixiemes(generateur) / 10.0, DESTINATIONS[destination(generateur)]);
+    if (ferror(f))
+        throw runtime_error("Erreur d'écriture du fichier " + p_nomFichier);
+}
+
+} // namespace microdrone
@@ -0,0 +1,25 @@
+/**
+ * \file GenerateurScenario.h
+ * \brief Déclaration du générateur de scénarios synthétiques pour les outils de mesure.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef GENERATEURSCENARIO_H_DEJA_INCLU
+#define GENERATEURSCENARIO_H_DEJA_INCLU
+
+#include <cstddef>
+#include <string>
+
+namespace microdrone
+{
+
+/**
+ * \brief Écrit un scénario texte de p_nbDrones drones et p_nbColis colis.
+ */
+void genererScenario(const std::string& p_nomFichier, std::size_t p_nbDrones, std::size_t p_nbColis,
+                     unsigned int p_graine = 1u);
+
+} // namespace microdrone
+
+#endif // GENERATEURSCENARIO_H_DEJA_INCLU
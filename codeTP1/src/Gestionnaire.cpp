@@ -11,227 +11,1091 @@
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <set>
 #include <vector>
-#include <memory>
+#include "AffectationOptimale.h"
 #include "ContratException.h"
+#include "LecteurScenario.h"
+#include "ScenarioBinaire.h"
+#include "TableChaines.h"
+#include "Traceur.h"
 
 using namespace std;
 
 namespace microdrone
 {
+
+namespace
+{
+const char* const NOMS_ETAPES[NB_ETAPES_LIVRAISON] = {"attente", "preparation", "vol", "bout_en_bout"};
+
+/**
+ * \brief Ajoute un modèle au catalogue d'un scénario en cours de chargement.
+ *
+ * \throw runtime_error si le modèle est défini deux fois.
+ */
+void ajouterModele(CatalogueModeles& p_catalogue, uint32_t p_nom, const CapaciteModele& p_capacite,
+                   string_view p_nomModele, size_t p_octet)
+{
+    if (!p_catalogue.ajouter(p_nom, p_capacite))
+        throw runtime_error("Scénario mal formé à l'octet " + to_string(p_octet)
+                            + " : modèle " + string(p_nomModele) + " défini deux fois");
+}
+
+/**
+ * \brief Colonnes de la flotte d'un scénario, résolues avant toute modification.
+ */
+struct DronesResolus
+{
+    vector<int> ids;
+    vector<uint32_t> modeles;
+    vector<double> chargesMax;
+    IndexIdentifiants index;
+
+    void reserver(size_t p_nb)
+    {
+        ids.reserve(p_nb);
+        modeles.reserve(p_nb);
+        chargesMax.reserve(p_nb);
+        index.reserver(p_nb);
+    }
+
+    // Un identifiant en double est refusé : la fin d'une mission retrouve son
+    // drone par son identifiant. Une charge nulle désigne celle du modèle.
+    void ajouter(const CatalogueModeles& p_catalogue, int p_id, uint32_t p_modele, double p_chargeMax,
+                 string_view p_nomModele, size_t p_octet)
+    {
+        if (!index.ajouter(p_id, ids.size()))
+            throw runtime_error("Scénario mal formé à l'octet " + to_string(p_octet)
+                                + " : drone #" + to_string(p_id) + " défini deux fois");
+        if (p_chargeMax == 0.0) {
+            const CapaciteModele* capacite = p_catalogue.trouver(p_modele);
+            if (capacite == nullptr)
+                throw runtime_error("Scénario mal formé à l'octet " + to_string(p_octet)
+                                    + " : modèle " + string(p_nomModele) + " sans charge utile connue");
+            p_chargeMax = capacite->chargeMax;
+        }
+        ids.push_back(p_id);
+        modeles.push_back(p_modele);
+        chargesMax.push_back(p_chargeMax);
+    }
+};
+
+uint64_t nanosecondesEntre(chrono::steady_clock::time_point p_debut, chrono::steady_clock::time_point p_fin)
+{
+    return p_fin > p_debut ? static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(p_fin - p_debut).count())
+                           : 0;
+}
+}
     /**
      * \brief Constructeur par défaut de la classe Gestionnaire.
      */
-Gestionnaire::Gestionnaire()
+Gestionnaire::Gestionnaire():m_notificationsActives(true), m_sortieAsynchrone(nullptr), m_sortie(&cout), m_prochainIdMission(1),
+    m_nbFilsChargement(1),
+    m_poidsMaxColis(numeric_limits<double>::infinity()),
+    m_chargeMaxFlotte(0.0), m_nbColisRefuses(0), m_nbColisHorsPortee(0), m_strategie(StrategieAffectation::MEILLEUR_AJUSTEMENT),
+    m_mode(ModePlanification::BLOQUANT), m_tailleFenetreOptimale(32), m_budgetOptimal(2000),
+    m_chargementMultiple(false)
 {
 }
 
     /**
-     * \brief Charge un scénario de drones et colis à partir d’un fichier texte.
+     * \brief Charge un scénario de drones et colis à partir d’un fichier texte
+     *        ou d'un scénario binaire produit par ConvertirScenario.
+     *
+     * Le fichier est projeté en mémoire et analysé sur place par LecteurScenario,
+     * sur m_nbFilsChargement fils; les structures ne sont réinitialisées qu'une
+     * fois l'analyse réussie. Un scénario binaire est lu par VueScenarioBinaire
+     * directement dans les colonnes de m_flotte et dans m_tousLesColis. Les
+     * lignes MODELE forment m_catalogue; un drone sans charge utile prend celle
+     * de son modèle.
      *
      * \param[in] p_nomFichier Le nom du fichier de scénario à charger.
      *
      * \pre p_nomFichier ne doit pas être vide.
-     * \post m_flotte, m_colisEnAttente, m_missionsPlanifiees, m_journalMissions
+     * \post m_flotte, m_colisEnAttente, m_missionsPlanifiees, m_missionsEnCours, m_journalMissions
      *       et m_tousLesColis sont initialisés à partir du fichier.
      *
      * \throw invalid_argument si le nom de fichier est vide.
-     * \throw runtime_error si le fichier ne peut pas être ouvert.
+     * \throw runtime_error si le fichier ne peut pas être ouvert, si une ligne
+     *        est mal formée, si un modèle ou un drone est défini deux fois ou si
+     *        un drone sans charge utile a un modèle inconnu (la position en
+     *        octets est indiquée).
      */
     void Gestionnaire::chargerScenario(const string& p_nomFichier){
+    TRACER_PORTEE("chargerScenario");
     if (p_nomFichier.empty()) {
         throw invalid_argument("Le nom du fichier ne peut pas être vide");
     }
-    
-    ifstream fichier(p_nomFichier);
-    if (!fichier) {
-        throw runtime_error("Impossible d'ouvrir le fichier " + p_nomFichier);
+
+    LecteurScenario lecteur(p_nomFichier);
+    const FichierProjete& fichier = lecteur.reqFichier();
+    optional<VueScenarioBinaire> binaire;
+    if (estScenarioBinaire(fichier.reqDonnees(), fichier.reqTaille()))
+        binaire.emplace(fichier.reqDonnees(), fichier.reqTaille());
+    else
+        lecteur.analyser(m_nbFilsChargement);
+
+    // Catalogue et drones sont résolus avant toute modification. Un scénario
+    // binaire nomme chaque modèle et chaque destination une seule fois : sa
+    // table des chaînes est internée d'un bloc et ses enregistrements sont lus
+    // directement dans la projection, sans enregistrements intermédiaires.
+    TableChaines& table = TableChaines::instance();
+    vector<uint32_t> internes;
+    CatalogueModeles catalogue;
+    DronesResolus drones;
+    if (binaire) {
+        const vector<string_view>& chaines = binaire->reqChaines();
+        internes.reserve(chaines.size());
+        for (string_view chaine : chaines)
+            internes.push_back(table.interner(chaine));
+        for (size_t i = 0; i < binaire->reqNbModeles(); ++i) {
+            const ModeleBinaire modele = binaire->reqModele(i);
+            ajouterModele(catalogue, internes[modele.nom],
+                          CapaciteModele{modele.chargeMax, modele.vitesse, modele.autonomie, modele.rotation},
+                          chaines[modele.nom], binaire->reqOctetModele(i));
+        }
+        drones.reserver(binaire->reqNbDrones());
+        for (size_t i = 0; i < binaire->reqNbDrones(); ++i) {
+            const DroneBinaire drone = binaire->reqDrone(i);
+            drones.ajouter(catalogue, drone.id, internes[drone.modele], drone.chargeMax, chaines[drone.modele],
+                           binaire->reqOctetDrone(i));
+        }
+    } else {
+        for (const EnregistrementModele& modele : lecteur.reqModeles())
+            ajouterModele(catalogue, table.interner(modele.nom),
+                          CapaciteModele{modele.chargeMax, modele.vitesse, modele.autonomie, modele.rotation},
+                          modele.nom, modele.octet);
+        drones.reserver(lecteur.reqDrones().size());
+        for (const EnregistrementDrone& drone : lecteur.reqDrones())
+            drones.ajouter(catalogue, drone.id, table.interner(drone.modele), drone.chargeMax, drone.modele,
+                           drone.octet);
     }
 
     // Réinitialiser les structures avant de charger le nouveau scénario
-    m_flotte.clear();
-    while (!m_colisEnAttente.empty()) {
-        m_colisEnAttente.pop();
-    }
-    m_missionsPlanifiees.clear();
+    m_colisEnAttente.vider();
+    m_colisDifferes.vider();
+    m_missionsPlanifiees.vider();
+    m_missionsEnCours.clear();
     m_journalMissions.clear();
+    m_missionsReservees.clear();
     m_tousLesColis.clear();
-    
-    string ligne;
-    int nbDrones = 0;
-    int nbColis = 0;
-    
-    while (getline(fichier, ligne)) {
-        if (ligne.empty() || ligne[0] == '#') {
-            // Ligne vide ou commentaire
-            continue;
-        }
-        
-        istringstream iss(ligne);
-        string type;
-        iss >> type;
-          if (type == "DRONE") {
-            int id;
-            string modele;
-            double chargeMax;
-            
-            iss >> id >> modele >> chargeMax;
-            
-            Drone nouveauDrone(id, modele, chargeMax);
-            m_flotte.push_back(nouveauDrone);
-            nbDrones++;
-        }
-        else if (type == "COLIS") {
-            int id;
-            double poids;
-            string destination;
-            
-            iss >> id >> poids;
-            
-            string reste;
-            getline(iss, reste);
-            size_t pos = reste.find_first_not_of(" \t");
-            if (pos != string::npos) {
-                destination = reste.substr(pos);
-            }
-            
-            Colis nouveauColis(id, poids, destination);
-            m_tousLesColis.push_back(nouveauColis);
-            m_colisEnAttente.push(nouveauColis);
-            nbColis++;
+    m_indexColis.vider();
+
+    m_catalogue = move(catalogue);
+
+    m_indexDrones = move(drones.index);
+    m_chargeMaxFlotte = 0.0;
+    m_nbColisRefuses = 0;
+    m_nbColisHorsPortee = 0;
+    for (double chargeMax : drones.chargesMax)
+        m_chargeMaxFlotte = max(m_chargeMaxFlotte, chargeMax);
+
+    // L'aller-retour vers une destination à d km dure 120 * d / vitesse minutes;
+    // un drone dont le modèle est inconnu n'a pas de limite.
+    m_porteesDrones.resize(drones.modeles.size());
+    for (size_t rang = 0; rang < drones.modeles.size(); ++rang) {
+        const CapaciteModele* capacite = m_catalogue.trouver(drones.modeles[rang]);
+        m_porteesDrones[rang] = capacite != nullptr ? capacite->autonomie * capacite->vitesse / 120.0
+                                                    : numeric_limits<double>::infinity();
+    }
+    vector<size_t> parCharge(drones.chargesMax.size());
+    iota(parCharge.begin(), parCharge.end(), size_t(0));
+    sort(parCharge.begin(), parCharge.end(),
+         [&](size_t a, size_t b) { return drones.chargesMax[a] > drones.chargesMax[b]; });
+    m_porteesParCharge.clear();
+    double porteeMax = 0.0;
+    for (size_t rang : parCharge) {
+        porteeMax = max(porteeMax, m_porteesDrones[rang]);
+        if (!m_porteesParCharge.empty() && m_porteesParCharge.back().first == drones.chargesMax[rang])
+            m_porteesParCharge.back().second = porteeMax;
+        else
+            m_porteesParCharge.emplace_back(drones.chargesMax[rang], porteeMax);
+    }
+    reverse(m_porteesParCharge.begin(), m_porteesParCharge.end());
+    m_dronesLibres.reinitialiser(drones.chargesMax, m_porteesDrones);
+    m_flotte.assigner(move(drones.ids), move(drones.modeles), move(drones.chargesMax));
+    m_missionParDrone.assign(m_flotte.taille(), m_missionsEnCours.end());
+    m_planificationParDrone.assign(m_flotte.taille(), chrono::steady_clock::time_point());
+    m_lancementParDrone.assign(m_flotte.taille(), chrono::steady_clock::time_point());
+    m_missionsEnCoursParId.clear();
+    m_missionsEnCoursParId.reserve(m_flotte.taille());
+    m_noeudsParIdLibres.clear();
+    m_noeudsParIdLibres.reserve(m_flotte.taille());
+    m_prochainIdMission = 1;
+    m_echeances = RoueTemporelle();
+    m_minuterieParDrone.assign(m_flotte.taille(), RoueTemporelle::AUCUNE);
+    // Un drone vole au plus une mission : un nœud par drone suffit au lancement.
+    m_missionsReservees.resize(m_flotte.taille(), Mission(1, 1));
+
+    auto ajouterColisCharge = [this](int p_id, double p_poids, auto p_destination) {
+        m_indexColis.ajouter(p_id, m_tousLesColis.size());
+        m_colisEnAttente.ajouter(m_tousLesColis.size());
+        m_tousLesColis.emplace_back(p_id, p_poids, p_destination);
+    };
+    if (binaire) {
+        m_indexColis.reserver(binaire->reqNbColis());
+        for (size_t i = 0; i < binaire->reqNbColis(); ++i) {
+            const ColisBinaire colis = binaire->reqColis(i);
+            ajouterColisCharge(colis.id, colis.poids, internes[colis.destination]);
         }
+    } else {
+        m_indexColis.reserver(lecteur.reqColis().size());
+        for (const EnregistrementColis& colis : lecteur.reqColis())
+            ajouterColisCharge(colis.id, colis.poids, colis.destination);
     }
-    
-    cout << "Scénario chargé : " << nbDrones << " drones et " << nbColis << " colis" << endl;
+    m_arriveeColis.assign(m_tousLesColis.size(), chrono::steady_clock::now());
+    for (HistogrammeLatences& histogramme : m_latences)
+        histogramme.vider();
+
+    *m_sortie << "Scénario chargé : " << m_flotte.taille() << " drones et " << m_tousLesColis.size() << " colis" << endl;
+}
+
+    /**
+     * \brief Ajoute un colis à la fin de la file d'attente.
+     *
+     * Sert aux colis qui arrivent en cours d'exploitation, par exemple ceux
+     * produits par le Simulateur.
+     *
+     * \param[in] p_id Identifiant du colis, unique dans le gestionnaire.
+     * \param[in] p_poids Poids du colis (> 0.0 kg).
+     * \param[in] p_destination Destination du colis (non vide).
+     *
+     * \throw invalid_argument si un colis porte déjà cet identifiant.
+     */
+void Gestionnaire::ajouterColis(int p_id, double p_poids, string_view p_destination)
+{
+    if (m_indexColis.trouver(p_id) != IndexIdentifiants::AUCUN)
+        throw invalid_argument("Le colis #" + to_string(p_id) + " existe déjà");
+    m_tousLesColis.emplace_back(p_id, p_poids, p_destination);
+    m_arriveeColis.push_back(chrono::steady_clock::now());
+    m_indexColis.ajouter(p_id, m_tousLesColis.size() - 1);
+    m_colisEnAttente.ajouter(m_tousLesColis.size() - 1);
+}
+
+    /**
+     * \brief Redirige les messages du gestionnaire.
+     *
+     * \param[in] p_sortie Le flux qui reçoit les messages; un flux sans tampon
+     *            (std::ostream(nullptr)) les supprime, ce qui convient aux simulations.
+     */
+void Gestionnaire::definirSortie(ostream& p_sortie)
+{
+    m_sortie = &p_sortie;
+}
+
+    /**
+     * \brief Active ou désactive la conservation des notifications.
+     *
+     * \param[in] p_actives false pour ignorer les notifications, par exemple
+     *            pendant une longue simulation.
+     */
+void Gestionnaire::definirNotificationsActives(bool p_actives)
+{
+    m_notificationsActives = p_actives;
+}
+
+    /**
+     * \brief Fixe le nombre de fils utilisés par chargerScenario.
+     *
+     * Le résultat du chargement ne dépend pas de ce nombre : seul le temps
+     * d'analyse change.
+     *
+     * \param[in] p_nbFils Nombre de fils (1 : séquentiel, 0 : selon le matériel).
+     */
+void Gestionnaire::definirNbFilsChargement(unsigned int p_nbFils)
+{
+    m_nbFilsChargement = p_nbFils;
+}
+
+    /**
+     * \brief Choisit la règle d'affectation utilisée par planifierMissions.
+     *
+     * \param[in] p_strategie PREMIER_AJUSTEMENT reproduit le choix historique
+     *            (premier drone libre de la flotte assez puissant);
+     *            MEILLEUR_AJUSTEMENT (par défaut) garde les gros porteurs
+     *            pour les colis lourds; OPTIMALE minimise la charge utile
+     *            gaspillée sur chaque fenêtre de colis (voir definirFenetreOptimale).
+     */
+void Gestionnaire::definirStrategieAffectation(StrategieAffectation p_strategie)
+{
+    m_strategie = p_strategie;
+}
+
+    /**
+     * \brief Règle la stratégie OPTIMALE.
+     *
+     * Chaque couplage porte sur les p_tailleFenetre prochains colis de la file.
+     * Si un couplage dépasse p_budget, la fenêtre est planifiée au premier
+     * ajustement, comme avec PREMIER_AJUSTEMENT.
+     *
+     * \param[in] p_tailleFenetre Nombre de colis par couplage (32 par défaut).
+     * \param[in] p_budget Temps alloué à un couplage (2 ms par défaut).
+     *
+     * \pre p_tailleFenetre > 0
+     */
+void Gestionnaire::definirFenetreOptimale(size_t p_tailleFenetre, chrono::microseconds p_budget)
+{
+    PRECONDITION(p_tailleFenetre > 0);
+    m_tailleFenetreOptimale = p_tailleFenetre;
+    m_budgetOptimal = p_budget;
+}
+
+    /**
+     * \brief Fixe une limite de poids propre à l'exploitation.
+     *
+     * Un colis est refusé s'il dépasse cette limite ou la plus grande charge
+     * utile de la flotte chargée; sans appel, seule la flotte fixe la limite.
+     *
+     * \param[in] p_poidsMax La limite en kg.
+     *
+     * \pre p_poidsMax > 0.0
+     */
+void Gestionnaire::definirPoidsMaxColis(double p_poidsMax)
+{
+    PRECONDITION(p_poidsMax > 0.0);
+    m_poidsMaxColis = p_poidsMax;
+}
+
+    /**
+     * \brief Fixe la distance d'une destination.
+     *
+     * La planification ne confie un colis qu'à un drone dont le modèle peut
+     * faire l'aller-retour dans son autonomie; un colis qu'aucun drone assez
+     * puissant n'atteint est refusé. Une destination sans distance n'est pas
+     * contrôlée.
+     *
+     * \param[in] p_destination La destination (non vide).
+     * \param[in] p_km La distance aller, en km.
+     *
+     * \pre !p_destination.empty()
+     * \pre p_km >= 0.0
+     */
+void Gestionnaire::definirDistanceDestination(string_view p_destination, double p_km)
+{
+    PRECONDITION(!p_destination.empty());
+    PRECONDITION(p_km >= 0.0);
+    const uint32_t destination = TableChaines::instance().interner(p_destination);
+    if (destination >= m_distancesDestinations.size())
+        m_distancesDestinations.resize(destination + 1, 0.0);
+    m_distancesDestinations[destination] = p_km;
+}
+
+    /**
+     * \brief Retourne le catalogue des modèles du dernier scénario chargé.
+     */
+const CatalogueModeles& Gestionnaire::reqCatalogue() const
+{
+    return m_catalogue;
+}
+
+    /**
+     * \brief Active ou désactive le chargement multiple.
+     *
+     * Activé, planifierMissions regroupe les colis en attente dans les drones
+     * jusqu'à leur charge utile (voir planifierChargements) au lieu de faire
+     * une sortie par colis.
+     *
+     * \param[in] p_actif true pour regrouper les colis.
+     */
+void Gestionnaire::definirChargementMultiple(bool p_actif)
+{
+    m_chargementMultiple = p_actif;
+}
+
+    /**
+     * \brief Choisit le comportement de planifierMissions quand un colis ne trouve pas de drone.
+     *
+     * \param[in] p_mode BLOQUANT (par défaut) arrête la planification;
+     *            DIFFERE met le colis de côté et continue avec les suivants.
+     */
+void Gestionnaire::definirModePlanification(ModePlanification p_mode)
+{
+    m_mode = p_mode;
 }
 
     /**
      * \brief Planifie les missions pour les colis en attente.
      *
+     * Le drone est obtenu de m_dronesLibres en O(log n) selon m_strategie;
+     * pour la stratégie VECTORIELLE, des masques calculés par m_noyau; pour la
+     * stratégie OPTIMALE, du couplage calculé pour la fenêtre du colis.
+     *
      * \post Les missions sont ajoutées à m_missionsPlanifiees si un drone est disponible.
-     * \post Les colis trop lourds ou sans drone disponible sont ignorés et génèrent une notification.
+     * \post Les colis plus lourds que reqPoidsMaxAccepte() ou sans drone disponible
+     *       sont ignorés et génèrent une notification.
+     * \post Un colis n'est confié qu'à un drone qui atteint sa destination
+     *       (definirDistanceDestination); s'il n'y en a aucun parmi ceux qui
+     *       peuvent le porter, il est refusé (COLIS_HORS_PORTEE).
+     * \post En mode BLOQUANT, la planification s'arrête au premier colis sans drone;
+     *       en mode DIFFERE, ce colis passe dans m_colisDifferes et les suivants
+     *       sont planifiés.
      */
     void Gestionnaire::planifierMissions()
 {
-    int nbColisAvant = m_colisEnAttente.size();
+    TRACER_PORTEE("planifierMissions");
+    if (m_chargementMultiple)
+    {
+        planifierChargements();
+        return;
+    }
+
+    int nbColisAvant = m_colisEnAttente.taille();
     int nbMissionsPlanifiees = 0;
+    const double poidsMax = reqPoidsMaxAccepte();
+    int nbColisDifferes = 0;
+
+    // Stratégie VECTORIELLE : les masques d'éligibilité des prochains colis
+    // de la file sont calculés par lots, en une passe sur la flotte par lot.
+    const bool vectorielle = m_strategie == StrategieAffectation::VECTORIELLE;
+    const size_t mots = NoyauEligibilite::nbMots(m_flotte.taille());
+    vector<uint64_t> masques;
+    vector<double> poidsLot;
+    size_t positionLot = 0;
 
-    while (!m_colisEnAttente.empty())
+    // Stratégie OPTIMALE : une fenêtre de colis est affectée d'un bloc;
+    // repliGlouton indique que le couplage a dépassé son budget.
+    const bool optimale = m_strategie == StrategieAffectation::OPTIMALE;
+    vector<size_t> affectationLot;
+    bool repliGlouton = false;
+
+    while (!m_colisEnAttente.estVide())
     {
-        Colis colis = m_colisEnAttente.front();
-        if (colis.reqPoids() > 2.0)
+        if (optimale && positionLot == poidsLot.size())
+        {
+            poidsLot.clear();
+            for (size_t rangColis : m_colisEnAttente)
+            {
+                if (poidsLot.size() == m_tailleFenetreOptimale)
+                    break;
+                const Colis& colis = m_tousLesColis[rangColis];
+                double poids = colis.reqPoids();
+                // Un colis trop lourd ou hors de portée est rejeté plus bas : il ne doit retenir aucun drone.
+                poidsLot.push_back(poids > poidsMax || distanceColis(colis) > reqPorteeMax(poids)
+                                   ? numeric_limits<double>::infinity() : poids);
+            }
+            repliGlouton = !affecterFenetreOptimale(poidsLot, affectationLot);
+            if (repliGlouton)
+                notifier(TypeNotification::REPLI_PREMIER_AJUSTEMENT);
+            positionLot = 0;
+        }
+        if (vectorielle && positionLot == poidsLot.size())
+        {
+            poidsLot.clear();
+            for (size_t rangColis : m_colisEnAttente)
+            {
+                if (poidsLot.size() == TAILLE_LOT_VECTORIEL)
+                    break;
+                poidsLot.push_back(m_tousLesColis[rangColis].reqPoids());
+            }
+            masques.resize(poidsLot.size() * mots);
+            m_noyau.calculerLot(m_flotte.reqChargesMax(), m_flotte.reqEtats(), m_flotte.taille(),
+                                poidsLot.data(), poidsLot.size(), masques.data());
+            positionLot = 0;
+        }
+        const size_t position = positionLot++;
+
+        const Colis& colis = m_tousLesColis[m_colisEnAttente.tete()];
+        if (colis.reqPoids() > poidsMax)
+        {
+            signalerColisTropLourd(colis);
+            m_colisEnAttente.retirer();
+            continue;
+        }
+        if (refuserSiHorsPortee(colis))
         {
-            m_notifications.push("Colis #" + to_string(colis.reqId()) + " trop lourd (> 2.0 kg)");
-            m_colisEnAttente.pop();
+            m_colisEnAttente.retirer();
             continue;
         }
-        bool missionPlanifiee = false;
-        for (Drone& drone : m_flotte)
+        size_t rangDrone;
+        if (vectorielle)
+            rangDrone = premierDroneLibre(masques.data() + position * mots, mots);
+        else if (optimale && !repliGlouton)
         {
-            if (drone.estDisponible() && colis.reqPoids() <= drone.reqChargeMax())
+            rangDrone = affectationLot[position];
+            // Le couplage peut laisser la tête de file sans drone au profit des
+            // colis suivants; en mode BLOQUANT elle prend alors un drone libre,
+            // et la fenêtre, dont un drone est peut-être pris, est recalculée.
+            if (rangDrone == IndexDronesLibres::AUCUN && m_mode == ModePlanification::BLOQUANT)
             {
-                drone.emporter(std::make_shared<Colis>(colis));
-                Mission mission(drone.reqId(), colis.reqId());
-                m_missionsPlanifiees.push_back(mission);
-                m_colisEnAttente.pop();
-                m_notifications.push("Mission planifiée pour colis #" + to_string(colis.reqId()));
-                nbMissionsPlanifiees++;
-                missionPlanifiee = true;
+                rangDrone = m_dronesLibres.trouver(colis.reqPoids(), StrategieAffectation::PREMIER_AJUSTEMENT);
+                positionLot = poidsLot.size();
+            }
+        }
+        else
+            rangDrone = m_dronesLibres.trouver(colis.reqPoids(), optimale
+                                               ? StrategieAffectation::PREMIER_AJUSTEMENT
+                                               : m_strategie);
+        // Les stratégies ne regardent que la charge utile : un drone qui n'atteint
+        // pas la destination cède la place au plus petit drone libre qui l'atteint.
+        if (rangDrone != IndexDronesLibres::AUCUN && !estAPortee(rangDrone, colis))
+        {
+            rangDrone = m_dronesLibres.trouverAPortee(colis.reqPoids(), distanceColis(colis));
+            if (optimale)
+                positionLot = poidsLot.size();
+        }
+        if (rangDrone == IndexDronesLibres::AUCUN)
+        {
+            if (m_mode == ModePlanification::BLOQUANT)
+            {
+                notifier(TypeNotification::AUCUN_DRONE, 0, colis.reqId());
                 break;
             }
+            // Le colis attend un drone à sa mesure sans bloquer les suivants.
+            m_colisDifferes.ajouter(m_colisEnAttente.tete(), colis.reqPoids());
+            m_colisEnAttente.retirer();
+            notifier(TypeNotification::COLIS_DIFFERE, 0, colis.reqId());
+            nbColisDifferes++;
+            continue;
         }
 
-        if (!missionPlanifiee)
+        planifierColis(rangDrone, colis);
+        m_colisEnAttente.retirer();
+        nbMissionsPlanifiees++;
+    }
+
+    int nbColisRestants = m_colisEnAttente.taille();
+
+    *m_sortie << nbColisAvant << " colis en attente\n";
+    *m_sortie << nbMissionsPlanifiees << " missions planifiées avec succès\n";
+    if (m_mode == ModePlanification::DIFFERE)
+        *m_sortie << nbColisDifferes << " colis différés jusqu'au retour d'un drone\n";
+    *m_sortie << nbColisRestants << " colis restent en attente\n";
+}
+
+    /**
+     * \brief Planifie tous les colis en attente en regroupant plusieurs colis par drone.
+     *
+     * Les colis sont placés du plus lourd au plus léger (Best-Fit Decreasing) :
+     * chacun va dans la sortie déjà ouverte qui lui laisse la plus petite charge
+     * utile restante, sinon dans un nouveau drone choisi par m_dronesLibres
+     * (premier ajustement si m_strategie le demande, meilleur ajustement sinon).
+     * Une sortie compte au plus Chargement::CAPACITE colis.
+     *
+     * \post Une mission est ajoutée à m_missionsPlanifiees pour chaque drone chargé.
+     * \post Les colis trop lourds ou hors de portée sont ignorés et génèrent une notification.
+     * \post Les colis sans drone restent en attente, dans leur ordre, en mode
+     *       BLOQUANT; ils passent dans m_colisDifferes en mode DIFFERE.
+     */
+void Gestionnaire::planifierChargements()
+{
+    struct Sortie
+    {
+        size_t rangDrone;
+        Chargement chargement;
+    };
+
+    const size_t nbColisAvant = m_colisEnAttente.taille();
+    vector<size_t> file(m_colisEnAttente.begin(), m_colisEnAttente.end());
+    m_colisEnAttente.vider();
+
+    const double poidsMax = reqPoidsMaxAccepte();
+    vector<size_t> ordre;
+    ordre.reserve(file.size());
+    for (size_t position = 0; position < file.size(); ++position)
+    {
+        const Colis& colis = m_tousLesColis[file[position]];
+        if (colis.reqPoids() > poidsMax)
+            signalerColisTropLourd(colis);
+        else if (!refuserSiHorsPortee(colis))
+            ordre.push_back(position);
+    }
+    stable_sort(ordre.begin(), ordre.end(), [&](size_t a, size_t b)
+    {
+        return m_tousLesColis[file[a]].reqPoids() > m_tousLesColis[file[b]].reqPoids();
+    });
+
+    const StrategieAffectation ouverture = m_strategie == StrategieAffectation::PREMIER_AJUSTEMENT
+                                           ? StrategieAffectation::PREMIER_AJUSTEMENT
+                                           : StrategieAffectation::MEILLEUR_AJUSTEMENT;
+    vector<Sortie> sorties;
+    set<pair<double, size_t>> ouvertes;   // (charge restante, indice dans sorties)
+    vector<size_t> sansDrone;             // positions dans file
+    size_t nbColisCharges = 0;
+
+    for (size_t position : ordre)
+    {
+        const Colis& colis = m_tousLesColis[file[position]];
+        const double poids = colis.reqPoids();
+        bool place = false;
+        for (auto it = ouvertes.lower_bound(make_pair(poids, size_t(0))); it != ouvertes.end(); ++it)
         {
-            m_notifications.push("Aucun drone disponible pour le colis #" + to_string(colis.reqId()));
+            Sortie& sortie = sorties[it->second];
+            const double chargeMax = m_flotte.reqChargesMax()[sortie.rangDrone];
+            // La clé est arrondie : le poids total est revérifié exactement.
+            if (sortie.chargement.reqPoidsTotal() + poids > chargeMax || !estAPortee(sortie.rangDrone, colis))
+                continue;
+            size_t indice = it->second;
+            ouvertes.erase(it);
+            sortie.chargement.ajouter(colis);
+            if (!sortie.chargement.estPlein())
+                ouvertes.emplace(chargeMax - sortie.chargement.reqPoidsTotal(), indice);
+            place = true;
             break;
         }
+        if (!place)
+        {
+            size_t rangDrone = m_dronesLibres.trouver(poids, ouverture);
+            if (rangDrone != IndexDronesLibres::AUCUN && !estAPortee(rangDrone, colis))
+                rangDrone = m_dronesLibres.trouverAPortee(poids, distanceColis(colis));
+            if (rangDrone == IndexDronesLibres::AUCUN)
+            {
+                sansDrone.push_back(position);
+                continue;
+            }
+            m_dronesLibres.retirer(rangDrone);
+            sorties.push_back(Sortie{rangDrone, Chargement()});
+            sorties.back().chargement.ajouter(colis);
+            ouvertes.emplace(m_flotte.reqChargesMax()[rangDrone] - poids, sorties.size() - 1);
+        }
+        nbColisCharges++;
     }
 
-    int nbColisRestants = m_colisEnAttente.size();
+    for (const Sortie& sortie : sorties)
+    {
+        m_flotte[sortie.rangDrone].emporter(sortie.chargement);
+        Mission mission(m_flotte[sortie.rangDrone].reqId(), sortie.chargement);
+        mission.definirId(m_prochainIdMission++);
+        mesurerPlanification(sortie.rangDrone, mission);
+        m_missionsPlanifiees.ajouter(mission);
+        notifier(TypeNotification::MISSION_PLANIFIEE, mission);
+    }
 
-    cout << nbColisAvant << " colis en attente\n";
-    cout << nbMissionsPlanifiees << " missions planifiées avec succès\n";
-    cout << nbColisRestants << " colis restent en attente\n";
+    // Les colis sans drone reprennent leur ordre d'arrivée.
+    sort(sansDrone.begin(), sansDrone.end());
+    for (size_t position : sansDrone)
+    {
+        const Colis& colis = m_tousLesColis[file[position]];
+        if (m_mode == ModePlanification::DIFFERE)
+        {
+            m_colisDifferes.ajouter(file[position], colis.reqPoids());
+            notifier(TypeNotification::COLIS_DIFFERE, 0, colis.reqId());
+        }
+        else
+        {
+            m_colisEnAttente.ajouter(file[position]);
+        }
+    }
+    if (m_mode == ModePlanification::BLOQUANT && !sansDrone.empty())
+        notifier(TypeNotification::AUCUN_DRONE, 0, m_tousLesColis[file[sansDrone.front()]].reqId());
+
+    *m_sortie << nbColisAvant << " colis en attente\n";
+    *m_sortie << sorties.size() << " missions planifiées avec succès (" << nbColisCharges << " colis chargés)\n";
+    if (m_mode == ModePlanification::DIFFERE)
+        *m_sortie << sansDrone.size() << " colis différés jusqu'au retour d'un drone\n";
+    *m_sortie << m_colisEnAttente.taille() << " colis restent en attente\n";
 }
 
     /**
  * \brief Lance la prochaine mission planifiée.
  *
- * Change l’état de la première mission planifiée (PLANIFIEE) à EN_COURS et affiche
- * les détails du lancement, incluant le drone et le colis.
+ * Retire la tête de la file m_missionsPlanifiees, la passe à EN_COURS dans
+ * m_missionsEnCours et affiche les détails du lancement, incluant le drone et le colis.
+ * Avec une sortie asynchrone, seule la notification MISSION_LANCEE est publiée;
+ * la sortie directe n'est pas vidée à chaque lancement.
  *
  * \post Une mission est marquée comme en cours.
  * \post Une notification est ajoutée à m_notifications.
+ *
+ * \return La mission lancée, ou nullptr si aucune mission n'était planifiée.
  */
 
 // Lance la prochaine mission planifiée
-void Gestionnaire::lancerMission()
+const Mission* Gestionnaire::lancerMission()
 {
+    TRACER_PORTEE("lancerMission");
+    if (m_missionsPlanifiees.estVide())
+    {
+        if (m_sortieAsynchrone == nullptr)
+            *m_sortie << "Aucune mission planifiée à lancer.\n";
+        notifier(TypeNotification::AUCUNE_MISSION_A_LANCER);
+        return nullptr;
+    }
+
+    Mission& mission = demarrerProchaineMission();
+    if (m_sortieAsynchrone == nullptr)
+        decrireLancement(mission, *m_sortie);
+    notifier(TypeNotification::MISSION_LANCEE, mission);
+    return &mission;
+}
 
-    for (Mission& mission : m_missionsPlanifiees)
+    /**
+     * \brief Lance jusqu'à p_nb missions planifiées en une passe.
+     *
+     * Les missions sont lancées dans l'ordre de la file, comme par autant
+     * d'appels à lancerMission, mais leurs messages sont écrits à la suite
+     * avec un seul vidage de la sortie; les notifications suivent, dans le
+     * même ordre. Avec une sortie asynchrone, seules les notifications sont
+     * publiées.
+     *
+     * \param[in] p_nb Le nombre maximal de missions à lancer.
+     * \return Le nombre de missions lancées.
+     */
+size_t Gestionnaire::lancerMissions(size_t p_nb)
+{
+    TRACER_PORTEE("lancerMissions");
+    if (m_missionsPlanifiees.estVide())
     {
-        if (mission.reqEtat() == MissionEtat::PLANIFIEE)
-        {
-            mission.definirEtat(MissionEtat::EN_COURS);
-
-            int droneId = mission.reqDroneId();
-            int colisId = mission.reqColisId();
-            const Colis* colisPtr = trouverColisParId(colisId);
-            if (colisPtr != nullptr){
-                std::cout << "Mission lancée : Drone D" << droneId
-                          << " affecté au colis C" << colisId
-                          << " (" << fixed << setprecision(1)
-                          << colisPtr->reqPoids() << " kg)" << endl;
-            }
-            else
-            {
-                cout << "Mission lancée : Drone D" << droneId << " affecté au colis C" << colisId << endl;
-            }
-            m_notifications.push("Mission lancée : " + mission.reqDescription());
-            return;
-        }
+        if (m_sortieAsynchrone == nullptr)
+            *m_sortie << "Aucune mission planifiée à lancer.\n";
+        notifier(TypeNotification::AUCUNE_MISSION_A_LANCER);
+        return 0;
+    }
+
+    const size_t nb = min(p_nb, m_missionsPlanifiees.taille());
+    m_lancements.clear();
+    m_lancements.reserve(nb);
+    for (size_t i = 0; i < nb; ++i)
+        m_lancements.push_back(&demarrerProchaineMission());
+
+    if (m_sortieAsynchrone == nullptr)
+    {
+        for (const Mission* mission : m_lancements)
+            decrireLancement(*mission, *m_sortie);
+        m_sortie->flush();
+    }
+
+    if (m_notificationsActives || m_sortieAsynchrone != nullptr)
+    {
+        for (const Mission* mission : m_lancements)
+            notifier(TypeNotification::MISSION_LANCEE, *mission);
     }
-    cout << "Aucune mission planifiée à lancer." << endl;
-    m_notifications.push("Aucune mission planifiée à lancer.");
+    return nb;
+}
+
+    /**
+     * \brief Lance toutes les missions planifiées (voir lancerMissions).
+     *
+     * \return Le nombre de missions lancées.
+     */
+size_t Gestionnaire::lancerToutesMissions()
+{
+    return lancerMissions(m_missionsPlanifiees.taille());
 }
 
 
     /**
      * \brief Termine la mission actuellement en cours.
      *
-     * Met à jour l’état de la première mission EN_COURS à TERMINEE, libère le drone correspondant
-     * et envoie un message de terminaison.
+     * Met à jour l’état de la plus ancienne mission EN_COURS à TERMINEE, libère le drone
+     * correspondant et envoie un message de terminaison (voir completerMission).
      */
     void Gestionnaire::terminerMission(){
-    for (auto it = m_missionsPlanifiees.begin(); it != m_missionsPlanifiees.end(); ++it) {
-        if (it->reqEtat() == MissionEtat::EN_COURS)
+    TRACER_PORTEE("terminerMission");
+    if (m_missionsEnCours.empty())
+    {
+        if (m_sortieAsynchrone == nullptr)
+            *m_sortie << "Aucune mission en cours à terminer\n";
+        notifier(TypeNotification::AUCUNE_MISSION_EN_COURS);
+        return;
+    }
+
+    completerMission(m_missionsEnCours.begin());
+}
+
+    /**
+     * \brief Termine la mission en cours d'un drone, quel que soit son rang de lancement.
+     *
+     * La mission est trouvée en O(1) par l'index des drones, sans parcourir
+     * la flotte ni les missions.
+     *
+     * \param[in] p_droneId L'identifiant du drone.
+     * \return false si le drone est inconnu ou n'a pas de mission en cours.
+     */
+bool Gestionnaire::terminerMission(int p_droneId)
+{
+    TRACER_PORTEE("terminerMission");
+    size_t rang = trouverRangDrone(p_droneId);
+    if (rang == IndexIdentifiants::AUCUN || !terminerMissionDuDrone(rang))
+    {
+        if (m_sortieAsynchrone == nullptr)
+            *m_sortie << "Aucune mission en cours pour le drone D" << p_droneId << '\n';
+        notifier(TypeNotification::AUCUNE_MISSION_EN_COURS, p_droneId);
+        return false;
+    }
+    return true;
+}
+
+    /**
+     * \brief Termine une mission en cours désignée par son identifiant, en O(1).
+     *
+     * \param[in] p_missionId L'identifiant attribué à la planification (Mission::reqId).
+     * \return false si aucune mission en cours ne porte cet identifiant.
+     */
+bool Gestionnaire::terminerMissionParId(MissionId p_missionId)
+{
+    TRACER_PORTEE("terminerMission");
+    auto trouvee = m_missionsEnCoursParId.find(p_missionId);
+    if (trouvee == m_missionsEnCoursParId.end())
+    {
+        if (m_sortieAsynchrone == nullptr)
+            *m_sortie << "Aucune mission en cours d'ID " << p_missionId << '\n';
+        notifier(TypeNotification::AUCUNE_MISSION_EN_COURS, 0, 0, 0.0, p_missionId);
+        return false;
+    }
+    completerMission(trouvee->second);
+    return true;
+}
+
+    /**
+     * \brief Applique un lot de fins de mission signalées par drone.
+     *
+     * Chaque fin est traitée comme terminerMission(int), dans l'ordre du lot,
+     * mais la sortie n'est vidée qu'une fois et les drones sans mission en
+     * cours sont ignorés sans message.
+     *
+     * \param[in] p_dronesIds Les identifiants des drones revenus.
+     * \param[in] p_nb Le nombre d'identifiants.
+     * \return Le nombre de missions terminées.
+     */
+size_t Gestionnaire::terminerMissions(const int* p_dronesIds, size_t p_nb)
+{
+    TRACER_PORTEE("terminerMissions");
+    size_t nbTerminees = 0;
+    for (size_t i = 0; i < p_nb; ++i)
+    {
+        size_t rang = trouverRangDrone(p_dronesIds[i]);
+        if (rang != IndexIdentifiants::AUCUN && terminerMissionDuDrone(rang))
+            nbTerminees++;
+    }
+    if (m_sortieAsynchrone == nullptr)
+        m_sortie->flush();
+    return nbTerminees;
+}
+
+    /**
+     * \brief Programme la fin de la mission en cours d'un drone.
+     *
+     * À l'échéance, avancerEcheances termine cette mission précise, comme
+     * terminerMissionDuDrone. Une fin déjà programmée pour ce drone est
+     * remplacée; une mission terminée avant son échéance annule sa minuterie.
+     * Programmer et annuler coûtent O(1), quel que soit le nombre de minuteries.
+     *
+     * \param[in] p_droneId L'identifiant du drone.
+     * \param[in] p_echeance Le tick de fin; un tick déjà passé expire au tick suivant.
+     * \return false si le drone est inconnu ou n'a pas de mission en cours.
+     */
+bool Gestionnaire::programmerFinMission(int p_droneId, uint64_t p_echeance)
+{
+    size_t rang = trouverRangDrone(p_droneId);
+    if (rang == IndexIdentifiants::AUCUN || m_missionParDrone[rang] == m_missionsEnCours.end())
+        return false;
+    m_echeances.annuler(m_minuterieParDrone[rang]);
+    m_minuterieParDrone[rang] = m_echeances.programmer(p_echeance, rang);
+    return true;
+}
+
+    /**
+     * \brief Avance l'horloge des fins de mission jusqu'au tick p_tick.
+     *
+     * Les missions dont l'échéance est atteinte sont terminées dans l'ordre des
+     * ticks (voir completerMission).
+     *
+     * \param[in] p_tick Le tick à atteindre.
+     * \param[in] p_arreterApresExpiration true pour s'arrêter au premier tick
+     *            où des missions se terminent (voir reqTickEcheances).
+     * \return Le nombre de missions terminées.
+     */
+size_t Gestionnaire::avancerEcheances(uint64_t p_tick, bool p_arreterApresExpiration)
+{
+    size_t nbTerminees = m_echeances.avancer(p_tick, [this](uint64_t p_rang, uint64_t) {
+        m_minuterieParDrone[p_rang] = RoueTemporelle::AUCUNE;
+        terminerMissionDuDrone(p_rang);
+    }, p_arreterApresExpiration);
+    if (nbTerminees > 0 && m_sortieAsynchrone == nullptr)
+        m_sortie->flush();
+    return nbTerminees;
+}
+
+uint64_t Gestionnaire::reqTickEcheances() const
+{
+    return m_echeances.reqTick();
+}
+
+    /**
+     * \brief Termine la mission en cours d'un drone donné, en O(1).
+     *
+     * \param[in] p_rangDrone Le rang du drone dans m_flotte.
+     * \return false si le drone n'a pas de mission en cours.
+     *
+     * \pre p_rangDrone < m_flotte.taille()
+     */
+bool Gestionnaire::terminerMissionDuDrone(size_t p_rangDrone)
+{
+    PRECONDITION(p_rangDrone < m_flotte.taille());
+    if (m_missionParDrone[p_rangDrone] == m_missionsEnCours.end())
+        return false;
+    completerMission(m_missionParDrone[p_rangDrone]);
+    return true;
+}
+
+    /**
+     * \brief Enregistre l'attente de chaque colis d'une mission planifiée à l'instant.
+     *
+     * \param[in] p_rangDrone Le rang du drone de la mission.
+     * \param[in] p_mission La mission planifiée.
+     */
+void Gestionnaire::mesurerPlanification(size_t p_rangDrone, const Mission& p_mission)
+{
+    const chrono::steady_clock::time_point maintenant = chrono::steady_clock::now();
+    m_planificationParDrone[p_rangDrone] = maintenant;
+    for (size_t i = 0; i < p_mission.reqNbColis(); ++i)
+    {
+        size_t rangColis = m_indexColis.trouver(p_mission.reqColisId(i));
+        if (rangColis != IndexIdentifiants::AUCUN)
+            m_latences[static_cast<size_t>(EtapeLivraison::ATTENTE)].enregistrer(
+                nanosecondesEntre(m_arriveeColis[rangColis], maintenant));
+    }
+}
+
+    /**
+     * \brief Enregistre le vol d'une mission qui se termine à l'instant et
+     *        la durée de bout en bout de chacun de ses colis.
+     *
+     * \param[in] p_rangDrone Le rang du drone de la mission.
+     * \param[in] p_mission La mission terminée.
+     */
+void Gestionnaire::mesurerFin(size_t p_rangDrone, const Mission& p_mission)
+{
+    const chrono::steady_clock::time_point maintenant = chrono::steady_clock::now();
+    m_latences[static_cast<size_t>(EtapeLivraison::VOL)].enregistrer(
+        nanosecondesEntre(m_lancementParDrone[p_rangDrone], maintenant));
+    for (size_t i = 0; i < p_mission.reqNbColis(); ++i)
+    {
+        size_t rangColis = m_indexColis.trouver(p_mission.reqColisId(i));
+        if (rangColis != IndexIdentifiants::AUCUN)
+            m_latences[static_cast<size_t>(EtapeLivraison::BOUT_EN_BOUT)].enregistrer(
+                nanosecondesEntre(m_arriveeColis[rangColis], maintenant));
+    }
+}
+
+    /**
+     * \brief Passe la tête de m_missionsPlanifiees à EN_COURS et l'indexe.
+     *
+     * \return La mission, désormais élément de m_missionsEnCours.
+     *
+     * \pre !m_missionsPlanifiees.estVide()
+     */
+Mission& Gestionnaire::demarrerProchaineMission()
+{
+    PRECONDITION(!m_missionsPlanifiees.estVide());
+    // Chaque drone a son nœud réservé, rendu à la fin de sa mission.
+    if (m_missionsReservees.empty())
+        m_missionsReservees.push_back(m_missionsPlanifiees.tete());
+    else
+        m_missionsReservees.front() = m_missionsPlanifiees.tete();
+    m_missionsEnCours.splice(m_missionsEnCours.end(), m_missionsReservees, m_missionsReservees.begin());
+    m_missionsPlanifiees.retirer();
+    list<Mission>::iterator mission = prev(m_missionsEnCours.end());
+    mission->definirEtat(MissionEtat::EN_COURS);
+    size_t rangDrone = trouverRangDrone(mission->reqDroneId());
+    if (rangDrone != IndexIdentifiants::AUCUN)
+    {
+        m_missionParDrone[rangDrone] = mission;
+        m_lancementParDrone[rangDrone] = chrono::steady_clock::now();
+        m_latences[static_cast<size_t>(EtapeLivraison::PREPARATION)].enregistrer(
+            nanosecondesEntre(m_planificationParDrone[rangDrone], m_lancementParDrone[rangDrone]));
+    }
+    if (m_noeudsParIdLibres.empty())
+    {
+        m_missionsEnCoursParId.emplace(mission->reqId(), mission);
+    }
+    else
+    {
+        m_noeudsParIdLibres.back().key() = mission->reqId();
+        m_noeudsParIdLibres.back().mapped() = mission;
+        m_missionsEnCoursParId.insert(move(m_noeudsParIdLibres.back()));
+        m_noeudsParIdLibres.pop_back();
+    }
+    return *mission;
+}
+
+    /**
+     * \brief Écrit la ligne annonçant le lancement d'une mission, sans vider p_flux.
+     *
+     * \param[in] p_mission La mission lancée.
+     * \param[out] p_flux Le flux qui reçoit la ligne.
+     */
+void Gestionnaire::decrireLancement(const Mission& p_mission, ostream& p_flux) const
+{
+    int droneId = p_mission.reqDroneId();
+    int colisId = p_mission.reqColisId();
+    const Colis* colisPtr = trouverColisParId(colisId);
+    if (p_mission.reqNbColis() > 1)
+    {
+        double poidsTotal = 0.0;
+        p_flux << "Mission lancée : Drone D" << droneId << " affecté aux colis C" << colisId;
+        for (size_t i = 1; i < p_mission.reqNbColis(); ++i)
+            p_flux << ", C" << p_mission.reqColisId(i);
+        for (size_t i = 0; i < p_mission.reqNbColis(); ++i)
         {
-            it->definirEtat(MissionEtat::TERMINEE);
-            int idDrone = it->reqDroneId();
+            const Colis* colis = trouverColisParId(p_mission.reqColisId(i));
+            if (colis != nullptr)
+                poidsTotal += colis->reqPoids();
+        }
+        p_flux << " (" << fixed << setprecision(1) << poidsTotal << " kg)\n";
+    }
+    else if (colisPtr != nullptr){
+        p_flux << "Mission lancée : Drone D" << droneId
+               << " affecté au colis C" << colisId
+               << " (" << fixed << setprecision(1)
+               << colisPtr->reqPoids() << " kg)\n";
+    }
+    else
+    {
+        p_flux << "Mission lancée : Drone D" << droneId << " affecté au colis C" << colisId << '\n';
+    }
+}
 
-            for (Drone& drone : m_flotte)
-            {
-                if (drone.reqId() == idDrone && !drone.estDisponible())
-                {
-                    drone.livrer();
-                    break;
-                }
-            }
+    /**
+     * \brief Passe une mission en cours à TERMINEE et libère son drone.
+     *
+     * Le drone libéré reprend aussitôt le plus lourd des colis différés qu'il
+     * peut porter. La mission passe de m_missionsEnCours à m_journalMissions
+     * par raccordement de liste, en O(1); un nœud neuf le remplace dans
+     * m_missionsReservees, si bien que l'allocation suit la croissance du
+     * journal plutôt que le lancement.
+     * Le message de fin n'est écrit qu'en l'absence de sortie asynchrone, qui
+     * reçoit déjà MISSION_TERMINEE. La sortie n'est pas vidée : c'est à
+     * l'appelant de le faire, une fois par lot.
+     *
+     * \param[in] p_mission La mission, élément de m_missionsEnCours.
+     */
+void Gestionnaire::completerMission(list<Mission>::iterator p_mission)
+{
+    p_mission->definirEtat(MissionEtat::TERMINEE);
+    int idDrone = p_mission->reqDroneId();
 
-            m_journalMissions.push_back(*it);
-            string message = " Mission terminée par le drone D" + to_string(idDrone);
-            cout << message << endl;
-            m_notifications.push(message);
-            m_missionsPlanifiees.erase(it);
-            return;
+    size_t rang = trouverRangDrone(idDrone);
+    if (rang != IndexIdentifiants::AUCUN)
+    {
+        mesurerFin(rang, *p_mission);
+        m_missionParDrone[rang] = m_missionsEnCours.end();
+        if (m_minuterieParDrone[rang] != RoueTemporelle::AUCUNE)
+        {
+            m_echeances.annuler(m_minuterieParDrone[rang]);
+            m_minuterieParDrone[rang] = RoueTemporelle::AUCUNE;
+        }
+        if (!m_flotte[rang].estDisponible())
+        {
+            libererDrone(rang);
+            replanifierColisDiffere(rang);
         }
     }
-    string message = "Aucune mission en cours à terminer";
-    cout << message << endl;
-    m_notifications.push(message);
+
+    auto noeud = m_missionsEnCoursParId.extract(p_mission->reqId());
+    if (!noeud.empty() && m_noeudsParIdLibres.size() < m_noeudsParIdLibres.capacity())
+        m_noeudsParIdLibres.push_back(move(noeud));
+    m_journalMissions.splice(m_journalMissions.end(), m_missionsEnCours, p_mission);
+    // Le nœud reste au journal; le drone en retrouve un pour sa prochaine mission.
+    if (m_missionsReservees.size() + m_missionsEnCours.size() < m_flotte.taille())
+        m_missionsReservees.push_back(*p_mission);
+    if (m_sortieAsynchrone == nullptr)
+        *m_sortie << " Mission terminée par le drone D" << idDrone << '\n';
+    notifier(TypeNotification::MISSION_TERMINEE, *p_mission);
 }
 
 
@@ -246,11 +1110,11 @@ string Gestionnaire::reqDescription() const
     ostringstream oss;
     oss << "État actuel du système :\n";
 
-    for (const Drone& drone : m_flotte)
+    for (const DroneVueConst drone : m_flotte)
         oss << drone.reqDescription() << "\n";
 
-    oss << "\nColis en attente : " << m_colisEnAttente.size() << "\n";
-    oss << "Missions planifiées : " << m_missionsPlanifiees.size() << "\n";
+    oss << "\nColis en attente : " << m_colisEnAttente.taille() << "\n";
+    oss << "Missions planifiées : " << m_missionsPlanifiees.taille() + m_missionsEnCours.size() << "\n";
     oss << "Missions terminées : " << m_journalMissions.size() << "\n";
 
     return oss.str();
@@ -266,61 +1130,446 @@ string Gestionnaire::reqDescription() const
     ostringstream oss;
     oss << endl;
 
-    int dronesDisponibles = 0;
-    int dronesEnMission = 0;
-
-    for (const Drone& drone : m_flotte)
-    {
-        if (drone.estDisponible())
-            dronesDisponibles++;
-        else
-            dronesEnMission++;
-    }
+    const StatistiquesFlotte compteurs = reqCompteurs();
 
-    oss << "Nombre de drones : " << m_flotte.size() << endl;
-    oss << "Drones disponibles : " << dronesDisponibles << endl;
-    oss << "Drones en mission : " << dronesEnMission << endl;
+    oss << "Nombre de drones : " << compteurs.nbDrones << endl;
+    oss << "Drones disponibles : " << compteurs.dronesDisponibles << endl;
+    oss << "Drones en mission : " << compteurs.dronesEnMission << endl;
     oss << endl;
-    oss << "Missions planifiées : " << m_missionsPlanifiees.size() << endl;
-    oss << "Missions terminées : " << m_journalMissions.size() << endl;
-    oss << "Colis en attente : " << m_colisEnAttente.size() << endl;
+    oss << "Missions planifiées : " << compteurs.missionsPlanifiees + compteurs.missionsEnCours << endl;
+    oss << "Missions terminées : " << compteurs.missionsTerminees << endl;
+    oss << "Colis en attente : " << compteurs.colisEnAttente << endl;
+    oss << "Colis différés : " << compteurs.colisDifferes << endl;
+    oss << "Colis refusés : " << compteurs.colisRefuses << endl;
+    oss << "Colis hors de portée : " << compteurs.colisHorsPortee << endl;
+
+    return oss.str();
+}
+
+    /**
+     * \brief Retourne les compteurs de la flotte et des files.
+     *
+     * Chaque compteur est tenu à jour à chaque transition (départ et retour
+     * de drone, ajout et retrait des files), si bien que la lecture coûte
+     * O(1) quelle que soit la taille de la flotte. En mode débogage, les
+     * compteurs sont comparés à un recomptage complet.
+     *
+     * \return Les compteurs courants.
+     */
+StatistiquesFlotte Gestionnaire::reqCompteurs() const
+{
+    StatistiquesFlotte compteurs;
+    compteurs.nbDrones = m_flotte.taille();
+    compteurs.dronesDisponibles = m_flotte.reqNbDisponibles();
+    compteurs.dronesEnMission = compteurs.nbDrones - compteurs.dronesDisponibles;
+    compteurs.missionsPlanifiees = m_missionsPlanifiees.taille();
+    compteurs.missionsEnCours = m_missionsEnCours.size();
+    compteurs.missionsTerminees = m_journalMissions.size();
+    compteurs.colisEnAttente = m_colisEnAttente.taille();
+    compteurs.colisDifferes = m_colisDifferes.taille();
+    compteurs.colisRefuses = m_nbColisRefuses;
+    compteurs.colisHorsPortee = m_nbColisHorsPortee;
+
+    ASSERTION(compteurs.dronesDisponibles == m_flotte.compterDisponibles());
+    ASSERTION(compteurs.dronesDisponibles == m_dronesLibres.reqNbLibres());
+    ASSERTION(compteurs.dronesEnMission == compteurs.missionsPlanifiees + compteurs.missionsEnCours);
+    return compteurs;
+}
+
+const HistogrammeLatences& Gestionnaire::reqLatences(EtapeLivraison p_etape) const
+{
+    return m_latences[static_cast<size_t>(p_etape)];
+}
 
+    /**
+     * \brief Retourne, pour chaque étape d'une livraison, le nombre de mesures,
+     *        la moyenne, p50, p90, p99, p99.9 et le maximum, en microsecondes.
+     *
+     * Les durées sont celles d'une horloge monotone, mesurées depuis le
+     * dernier chargement de scénario; elles sont exactes à environ 3 % près.
+     */
+string Gestionnaire::reqStatistiquesDetaillees() const
+{
+    ostringstream oss;
+    oss << reqStatistiques() << endl;
+    oss << "Latences (µs) : nb, moyenne, p50, p90, p99, p99.9, max" << endl;
+    oss << fixed << setprecision(1);
+    for (size_t etape = 0; etape < NB_ETAPES_LIVRAISON; ++etape)
+    {
+        const HistogrammeLatences& histogramme = m_latences[etape];
+        oss << NOMS_ETAPES[etape] << " : " << histogramme.reqNbValeurs()
+            << ", " << histogramme.reqMoyenne() / 1e3;
+        for (double quantile : {0.5, 0.9, 0.99, 0.999})
+            oss << ", " << static_cast<double>(histogramme.reqQuantile(quantile)) / 1e3;
+        oss << ", " << static_cast<double>(histogramme.reqMax()) / 1e3 << endl;
+    }
     return oss.str();
 }
 
+    /**
+     * \brief Écrit les durées de chaque étape sous forme d'un objet JSON.
+     *
+     * Chaque étape donne nb, moyenne_ns, p50_ns, p90_ns, p99_ns, p999_ns et
+     * max_ns, par exemple pour un outil de supervision.
+     *
+     * \param[out] p_flux Le flux qui reçoit l'objet, suivi d'un saut de ligne.
+     */
+void Gestionnaire::exporterLatences(ostream& p_flux) const
+{
+    p_flux << "{";
+    for (size_t etape = 0; etape < NB_ETAPES_LIVRAISON; ++etape)
+    {
+        const HistogrammeLatences& histogramme = m_latences[etape];
+        p_flux << (etape > 0 ? ", " : "") << "\"" << NOMS_ETAPES[etape] << "\": {"
+               << "\"nb\": " << histogramme.reqNbValeurs()
+               << ", \"moyenne_ns\": " << static_cast<uint64_t>(histogramme.reqMoyenne())
+               << ", \"p50_ns\": " << histogramme.reqQuantile(0.5)
+               << ", \"p90_ns\": " << histogramme.reqQuantile(0.9)
+               << ", \"p99_ns\": " << histogramme.reqQuantile(0.99)
+               << ", \"p999_ns\": " << histogramme.reqQuantile(0.999)
+               << ", \"max_ns\": " << histogramme.reqMax() << "}";
+    }
+    p_flux << "}" << endl;
+}
+
     /**
      * \brief Cherche un colis à partir de son identifiant.
      *
+     * La recherche passe par m_indexColis et coûte O(1).
+     *
      * \param[in] p_colisId L’identifiant du colis recherché.
      * \return Un pointeur constant vers le colis si trouvé, nullptr sinon.
      */
     const Colis* Gestionnaire::trouverColisParId(int p_colisId) const{
-    for (const Colis& c : m_tousLesColis)
+    size_t rang = m_indexColis.trouver(p_colisId);
+    if (rang == IndexIdentifiants::AUCUN)
+        return nullptr;
+    return &m_tousLesColis[rang];
+}
+
+    /**
+     * \brief Cherche le rang d'un drone à partir de son identifiant.
+     *
+     * La recherche passe par m_indexDrones et coûte O(1).
+     *
+     * \param[in] p_droneId L’identifiant du drone recherché.
+     * \return Le rang du drone dans m_flotte, ou IndexIdentifiants::AUCUN.
+     */
+size_t Gestionnaire::trouverRangDrone(int p_droneId) const
+{
+    return m_indexDrones.trouver(p_droneId);
+}
+
+    /**
+     * \brief Retourne le premier drone d'un masque d'éligibilité encore libre.
+     *
+     * Le masque a été calculé au début du lot : les drones affectés depuis
+     * aux colis précédents du lot sont sautés.
+     *
+     * \param[in] p_masque Le masque (un bit par rang de drone).
+     * \param[in] p_nbMots Le nombre de mots du masque.
+     * \return Le rang du drone, ou IndexDronesLibres::AUCUN.
+     */
+size_t Gestionnaire::premierDroneLibre(const uint64_t* p_masque, size_t p_nbMots) const
+{
+    const DroneEtat* etats = m_flotte.reqEtats();
+    for (size_t mot = 0; mot < p_nbMots; ++mot)
+    {
+        for (uint64_t bits = p_masque[mot]; bits != 0; bits &= bits - 1)
+        {
+            size_t rang = mot * 64 + static_cast<size_t>(__builtin_ctzll(bits));
+            if (etats[rang] == DroneEtat::LIBRE)
+                return rang;
+        }
+    }
+    return IndexDronesLibres::AUCUN;
+}
+
+    /**
+     * \brief Retourne la limite de poids appliquée par la planification.
+     *
+     * \return La plus petite valeur entre m_poidsMaxColis et la plus grande
+     *         charge utile de la flotte : aucun drone ne pourrait porter un
+     *         colis plus lourd. Sans flotte, m_poidsMaxColis seul : les colis
+     *         attendent alors un drone (« Aucun drone ») au lieu d'être refusés.
+     */
+double Gestionnaire::reqPoidsMaxAccepte() const
+{
+    if (m_flotte.taille() == 0)
+        return m_poidsMaxColis;
+    return min(m_poidsMaxColis, m_chargeMaxFlotte);
+}
+
+    /**
+     * \brief Ajoute la notification d'un colis refusé.
+     *
+     * \param[in] p_colis Le colis dépassant reqPoidsMaxAccepte().
+     */
+void Gestionnaire::signalerColisTropLourd(const Colis& p_colis)
+{
+    m_nbColisRefuses++;
+    notifier(TypeNotification::COLIS_TROP_LOURD, 0, p_colis.reqId(), reqPoidsMaxAccepte());
+}
+
+    /**
+     * \brief Retourne la distance de la destination d'un colis.
+     *
+     * \return La distance fixée par definirDistanceDestination, en km, ou 0.0.
+     */
+double Gestionnaire::distanceColis(const Colis& p_colis) const
+{
+    const uint32_t destination = p_colis.reqIdDestination();
+    return destination < m_distancesDestinations.size() ? m_distancesDestinations[destination] : 0.0;
+}
+
+    /**
+     * \brief Retourne la plus grande portée des drones qui peuvent porter p_poids.
+     *
+     * \return La portée en km, en O(log m) pour m charges utiles distinctes;
+     *         0.0 si aucun drone ne porte p_poids. Sans flotte, l'infini : les
+     *         colis attendent alors un drone, comme pour reqPoidsMaxAccepte.
+     */
+double Gestionnaire::reqPorteeMax(double p_poids) const
+{
+    if (m_flotte.taille() == 0)
+        return numeric_limits<double>::infinity();
+    auto it = lower_bound(m_porteesParCharge.begin(), m_porteesParCharge.end(),
+                          make_pair(p_poids, -numeric_limits<double>::infinity()));
+    return it == m_porteesParCharge.end() ? 0.0 : it->second;
+}
+
+    /**
+     * \brief Indique si un drone peut faire l'aller-retour vers la destination d'un colis.
+     *
+     * \pre p_rangDrone < m_flotte.taille()
+     */
+bool Gestionnaire::estAPortee(size_t p_rangDrone, const Colis& p_colis) const
+{
+    PRECONDITION(p_rangDrone < m_flotte.taille());
+    return distanceColis(p_colis) <= m_porteesDrones[p_rangDrone];
+}
+
+    /**
+     * \brief Refuse un colis dont la destination dépasse la portée de tous les
+     *        drones qui peuvent le porter, et ajoute la notification.
+     *
+     * \param[in] p_colis Le colis, qui ne dépasse pas reqPoidsMaxAccepte().
+     * \return true si le colis est refusé.
+     */
+bool Gestionnaire::refuserSiHorsPortee(const Colis& p_colis)
+{
+    const double porteeMax = reqPorteeMax(p_colis.reqPoids());
+    if (distanceColis(p_colis) <= porteeMax)
+        return false;
+    m_nbColisHorsPortee++;
+    notifier(TypeNotification::COLIS_HORS_PORTEE, 0, p_colis.reqId(), porteeMax);
+    return true;
+}
+
+    /**
+     * \brief Affecte une fenêtre de colis aux drones libres en minimisant
+     *        la charge utile gaspillée.
+     *
+     * Des drones de même charge utile étant interchangeables, seuls
+     * p_poids.size() drones libres par charge utile sont candidats : la taille
+     * du couplage dépend du nombre de modèles, non de la taille de la flotte.
+     * En mode BLOQUANT, les colis suivant le premier colis sans drone ne sont
+     * pas planifiés et leurs drones restent libres.
+     *
+     * \param[in] p_poids Le poids de chaque colis de la fenêtre (infini : à rejeter).
+     * \param[out] p_rangsDrones Pour chaque colis, le rang du drone dans m_flotte,
+     *              ou IndexDronesLibres::AUCUN.
+     * \return false si le budget m_budgetOptimal a été dépassé.
+     */
+bool Gestionnaire::affecterFenetreOptimale(const vector<double>& p_poids, vector<size_t>& p_rangsDrones) const
+{
+    vector<size_t> candidats;
+    m_dronesLibres.listerCandidats(p_poids.size(), candidats);
+    vector<double> chargesMax;
+    chargesMax.reserve(candidats.size());
+    for (size_t rang : candidats)
+        chargesMax.push_back(m_flotte.reqChargesMax()[rang]);
+
+    vector<size_t> affectation;
+    if (!affecterAuMoindreCout(p_poids, chargesMax, chrono::steady_clock::now() + m_budgetOptimal, affectation))
+        return false;
+
+    p_rangsDrones.assign(p_poids.size(), IndexDronesLibres::AUCUN);
+    for (size_t i = 0; i < affectation.size(); ++i)
     {
-        if (c.reqId() == p_colisId)
-            return &c;
+        if (affectation[i] != SANS_DRONE)
+            p_rangsDrones[i] = candidats[affectation[i]];
     }
-    return nullptr;
+    return true;
+}
+
+    /**
+     * \brief Affecte un colis à un drone libre et crée la mission planifiée.
+     *
+     * \param[in] p_rangDrone Le rang du drone dans m_flotte.
+     * \param[in] p_colis Le colis, qui doit appartenir à m_tousLesColis.
+     */
+void Gestionnaire::planifierColis(size_t p_rangDrone, const Colis& p_colis)
+{
+    affecterColis(p_rangDrone, p_colis);
+    Mission mission(m_flotte[p_rangDrone].reqId(), p_colis.reqId());
+    mission.definirId(m_prochainIdMission++);
+    mesurerPlanification(p_rangDrone, mission);
+    m_missionsPlanifiees.ajouter(mission);
+    notifier(TypeNotification::MISSION_PLANIFIEE, mission);
+}
+
+    /**
+     * \brief Donne à un drone qui vient de se libérer un colis différé.
+     *
+     * \param[in] p_rangDrone Le rang du drone libéré dans m_flotte.
+     * \return true si une mission a été planifiée.
+     */
+bool Gestionnaire::replanifierColisDiffere(size_t p_rangDrone)
+{
+    if (m_colisDifferes.estVide())
+        return false;
+    size_t rangColis = m_colisDifferes.extraire(m_flotte[p_rangDrone].reqChargeMax());
+    if (rangColis == ColisDifferes::AUCUN)
+        return false;
+    const Colis& colis = m_tousLesColis[rangColis];
+    // Trop loin pour ce drone : le colis attend le retour d'un drone de plus grande portée.
+    if (!estAPortee(p_rangDrone, colis))
+    {
+        m_colisDifferes.ajouter(rangColis, colis.reqPoids());
+        return false;
+    }
+    planifierColis(p_rangDrone, colis);
+    return true;
+}
+
+    /**
+     * \brief Fait emporter un colis par un drone et tient l'index à jour.
+     *
+     * \param[in] p_rangDrone Le rang du drone dans m_flotte.
+     * \param[in] p_colis Le colis à emporter, qui doit appartenir à m_tousLesColis.
+     *
+     * \pre p_rangDrone < m_flotte.taille()
+     */
+void Gestionnaire::affecterColis(size_t p_rangDrone, const Colis& p_colis)
+{
+    PRECONDITION(p_rangDrone < m_flotte.taille());
+    m_flotte[p_rangDrone].emporter(p_colis);
+    m_dronesLibres.retirer(p_rangDrone);
+}
+
+    /**
+     * \brief Fait livrer un drone et le remet dans l'index des drones libres.
+     *
+     * \param[in] p_rangDrone Le rang du drone dans m_flotte.
+     *
+     * \pre p_rangDrone < m_flotte.taille()
+     */
+void Gestionnaire::libererDrone(size_t p_rangDrone)
+{
+    PRECONDITION(p_rangDrone < m_flotte.taille());
+    m_flotte[p_rangDrone].livrer();
+    m_dronesLibres.ajouter(p_rangDrone);
+}
+
+    /**
+     * \brief Conserve une notification dans le journal, sauf si elles sont désactivées.
+     *
+     * Seuls le type, les identifiants et l'instant sont retenus; le texte
+     * n'est composé qu'à la lecture (Notification::formater).
+     *
+     * \param[in] p_type La nature de la notification.
+     * \param[in] p_droneId Le drone concerné (0 : aucun).
+     * \param[in] p_colisId Le colis concerné (0 : aucun).
+     * \param[in] p_poids Le poids associé (0.0 : aucun).
+     * \param[in] p_missionId La mission concernée (0 : aucune).
+     */
+void Gestionnaire::notifier(TypeNotification p_type, int p_droneId, int p_colisId, double p_poids,
+                            MissionId p_missionId)
+{
+    if (m_notificationsActives || m_sortieAsynchrone != nullptr)
+        diffuser(Notification{chrono::steady_clock::now(), p_missionId, p_poids, p_droneId, p_colisId, 0, p_type});
+}
+
+    /**
+     * \brief Conserve une notification portant sur une mission.
+     *
+     * \param[in] p_type La nature de la notification.
+     * \param[in] p_mission La mission : son ID, son drone et ses colis sont retenus.
+     */
+void Gestionnaire::notifier(TypeNotification p_type, const Mission& p_mission)
+{
+    if (m_notificationsActives || m_sortieAsynchrone != nullptr)
+        diffuser(Notification{chrono::steady_clock::now(), p_mission.reqId(), 0.0, p_mission.reqDroneId(),
+                              p_mission.reqColisId(), static_cast<uint8_t>(p_mission.reqNbColis()), p_type});
+}
+
+    /**
+     * \brief Range une notification dans le journal, s'il est actif, et la
+     *        confie à la sortie asynchrone, s'il y en a une.
+     */
+void Gestionnaire::diffuser(const Notification& p_notification)
+{
+    if (m_notificationsActives)
+        m_notifications.ajouter(p_notification);
+    if (m_sortieAsynchrone != nullptr)
+        m_sortieAsynchrone->publier(p_notification);
+}
+
+    /**
+     * \brief Remplace le journal des notifications par un journal vide.
+     *
+     * \param[in] p_capacite Le nombre maximal de notifications conservées.
+     * \param[in] p_politique Le comportement du journal plein.
+     *
+     * \pre p_capacite > 0
+     */
+void Gestionnaire::definirJournalNotifications(size_t p_capacite, PolitiqueDebordement p_politique)
+{
+    PRECONDITION(p_capacite > 0);
+    m_notifications = JournalNotifications(p_capacite, p_politique);
+}
+
+    /**
+     * \brief Écrit aussi chaque notification sur une sortie asynchrone.
+     *
+     * Le fil appelant ne fait que déposer la notification dans la file de la
+     * sortie; son fil d'arrière-plan la formate et l'écrit. Le gestionnaire
+     * doit être le seul à publier sur cette sortie. Tant qu'elle est attachée,
+     * les lancements et les fins de mission ne sont plus écrits sur la sortie
+     * directe : MISSION_LANCEE, MISSION_TERMINEE et les demandes sans mission
+     * passent seulement par elle.
+     *
+     * \param[in] p_sortie La sortie, qui doit survivre à son usage; nullptr la détache.
+     */
+void Gestionnaire::definirSortieAsynchrone(SortieAsynchrone* p_sortie)
+{
+    m_sortieAsynchrone = p_sortie;
+}
+
+const JournalNotifications& Gestionnaire::reqNotifications() const
+{
+    return m_notifications;
 }
 
     /**
     * \brief Affiche la dernière notification du système.
     *
-    * Retire la notification du dessus de la pile m_notifications et l’affiche.
+    * Retire la notification la plus récente de m_notifications et affiche son texte.
     * Si aucune notification n’est présente, affiche un message par défaut.
     */
 void Gestionnaire::afficherDerniereNotification()
 {
-    cout << endl;
+    *m_sortie << endl;
 
-    if (!m_notifications.empty())
+    if (!m_notifications.estVide())
     {
-        cout << m_notifications.top() << endl;
-        m_notifications.pop();
+        *m_sortie << m_notifications.derniere().formater() << endl;
+        m_notifications.retirerDerniere();
     }
     else
     {
-        cout << "Aucune notification à afficher." << endl;
+        *m_sortie << "Aucune notification à afficher." << endl;
     }
 }
 
@@ -8,18 +8,68 @@
 #ifndef GESTIONNAIRE_H_DEJA_INCLU
 #define GESTIONNAIRE_H_DEJA_INCLU
 
-#include <queue>
+#include <array>
+#include <chrono>
+#include <deque>
 #include <list>
+#include <ostream>
 #include <string>
 #include <vector>
-#include <stack>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include "Drone.h"
+#include "FlotteSoA.h"
 #include "Colis.h"
 #include "Mission.h"
+#include "FileContigue.h"
+#include "HistogrammeLatences.h"
+#include "CatalogueModeles.h"
+#include "ColisDifferes.h"
+#include "IndexDronesLibres.h"
+#include "NoyauEligibilite.h"
+#include "IndexIdentifiants.h"
+#include "JournalNotifications.h"
+#include "RoueTemporelle.h"
+#include "SortieAsynchrone.h"
 
 namespace microdrone
 {
 
+//! Comportement de la planification quand un colis ne trouve pas de drone.
+enum class ModePlanification
+{
+    BLOQUANT,   /*!< La planification s'arrête (comportement historique) */
+    DIFFERE     /*!< Le colis est mis de côté jusqu'au retour d'un drone capable */
+};
+
+//! Étape du cycle de vie d'une livraison dont la durée est mesurée.
+enum class EtapeLivraison
+{
+    ATTENTE,        /*!< Arrivée du colis → planification de sa mission (par colis) */
+    PREPARATION,    /*!< Planification → lancement de la mission */
+    VOL,            /*!< Lancement → fin de la mission */
+    BOUT_EN_BOUT    /*!< Arrivée du colis → fin de sa mission (par colis) */
+};
+const std::size_t NB_ETAPES_LIVRAISON = 4; //!< Nombre de valeurs de EtapeLivraison.
+
+/**
+ * \brief Compteurs de la flotte et des files, lus en O(1).
+ */
+struct StatistiquesFlotte
+{
+    std::size_t nbDrones = 0;               //!< Drones de la flotte.
+    std::size_t dronesDisponibles = 0;      //!< Drones libres.
+    std::size_t dronesEnMission = 0;        //!< Drones affectés à une mission planifiée ou en cours.
+    std::size_t missionsPlanifiees = 0;     //!< Missions pas encore lancées.
+    std::size_t missionsEnCours = 0;        //!< Missions lancées, pas encore terminées.
+    std::size_t missionsTerminees = 0;      //!< Missions du journal.
+    std::size_t colisEnAttente = 0;         //!< Colis de la file d'attente.
+    std::size_t colisDifferes = 0;          //!< Colis mis de côté (mode DIFFERE).
+    std::size_t colisRefuses = 0;           //!< Colis refusés parce que trop lourds.
+    std::size_t colisHorsPortee = 0;        //!< Colis refusés, hors de portée des drones assez puissants.
+};
+
 /**
  * \brief Classe gérant les opérations de livraison par drone.
  */
@@ -36,6 +86,76 @@ public:
      */
     void chargerScenario(const std::string& p_nomFichier);
 
+    /**
+     * \brief Ajoute un colis arrivé après le chargement du scénario.
+     */
+    void ajouterColis(int p_id, double p_poids, std::string_view p_destination);
+
+    /**
+     * \brief Redirige les messages affichés par le gestionnaire.
+     */
+    void definirSortie(std::ostream& p_sortie);
+
+    /**
+     * \brief Active ou désactive la conservation des notifications.
+     */
+    void definirNotificationsActives(bool p_actives);
+
+    /**
+     * \brief Remplace le journal des notifications par un journal vide.
+     */
+    void definirJournalNotifications(std::size_t p_capacite, PolitiqueDebordement p_politique);
+
+    /**
+     * \brief Écrit les notifications sur une sortie asynchrone, à la place des messages de mission (nullptr : aucune).
+     */
+    void definirSortieAsynchrone(SortieAsynchrone* p_sortie);
+
+    /**
+     * \brief Retourne le journal des notifications.
+     */
+    const JournalNotifications& reqNotifications() const;
+
+    /**
+     * \brief Fixe le nombre de fils utilisés pour analyser un scénario.
+     */
+    void definirNbFilsChargement(unsigned int p_nbFils);
+
+    /**
+     * \brief Choisit la règle d'affectation des drones aux colis.
+     */
+    void definirStrategieAffectation(StrategieAffectation p_strategie);
+
+    /**
+     * \brief Règle la fenêtre et le budget de temps de la stratégie OPTIMALE.
+     */
+    void definirFenetreOptimale(std::size_t p_tailleFenetre, std::chrono::microseconds p_budget);
+
+    /**
+     * \brief Fixe le poids au-delà duquel un colis est refusé.
+     */
+    void definirPoidsMaxColis(double p_poidsMax);
+
+    /**
+     * \brief Fixe la distance d'une destination, pour le contrôle de portée.
+     */
+    void definirDistanceDestination(std::string_view p_destination, double p_km);
+
+    /**
+     * \brief Retourne les capacités des modèles du scénario chargé.
+     */
+    const CatalogueModeles& reqCatalogue() const;
+
+    /**
+     * \brief Active le regroupement de plusieurs colis par sortie.
+     */
+    void definirChargementMultiple(bool p_actif);
+
+    /**
+     * \brief Choisit le comportement face à un colis sans drone disponible.
+     */
+    void definirModePlanification(ModePlanification p_mode);
+
     /**
      * \brief Planifie les missions pour les colis en attente.
      */
@@ -44,13 +164,53 @@ public:
     /**
      * \brief Lance la prochaine mission planifiée.
      */
-    void lancerMission();
+    const Mission* lancerMission();
+
+    /**
+     * \brief Lance jusqu'à p_nb missions planifiées en une passe.
+     */
+    std::size_t lancerMissions(std::size_t p_nb);
+
+    /**
+     * \brief Lance toutes les missions planifiées.
+     */
+    std::size_t lancerToutesMissions();
 
     /**
      * \brief Termine la mission en cours.
      */
     void terminerMission();
 
+    /**
+     * \brief Termine la mission en cours d'un drone donné.
+     */
+    bool terminerMission(int p_droneId);
+
+    /**
+     * \brief Termine une mission en cours désignée par son identifiant.
+     */
+    bool terminerMissionParId(MissionId p_missionId);
+
+    /**
+     * \brief Termine en une passe les missions en cours de plusieurs drones.
+     */
+    std::size_t terminerMissions(const int* p_dronesIds, std::size_t p_nb);
+
+    /**
+     * \brief Programme la fin de la mission en cours d'un drone au tick p_echeance.
+     */
+    bool programmerFinMission(int p_droneId, std::uint64_t p_echeance);
+
+    /**
+     * \brief Avance l'horloge des fins de mission et termine les missions échues.
+     */
+    std::size_t avancerEcheances(std::uint64_t p_tick, bool p_arreterApresExpiration = false);
+
+    /**
+     * \brief Retourne le tick courant de l'horloge des fins de mission.
+     */
+    std::uint64_t reqTickEcheances() const;
+
     /**
      * \brief Retourne une description de l'état actuel.
      */
@@ -61,23 +221,198 @@ public:
      */
     std::string reqStatistiques() const;
 
+    /**
+     * \brief Retourne les compteurs de la flotte, en temps constant.
+     */
+    StatistiquesFlotte reqCompteurs() const;
+
+    /**
+     * \brief Retourne l'histogramme des durées d'une étape.
+     */
+    const HistogrammeLatences& reqLatences(EtapeLivraison p_etape) const;
+
+    /**
+     * \brief Retourne les quantiles des durées de chaque étape.
+     */
+    std::string reqStatistiquesDetaillees() const;
+
+    /**
+     * \brief Écrit les durées de chaque étape en JSON.
+     */
+    void exporterLatences(std::ostream& p_flux) const;
+
     /**
      * \brief Affiche puis retire la dernière notification système.
      */
     void afficherDerniereNotification();
 
 private:
+    friend class Simulateur;
+
+    /**
+     * \brief Conserve une notification système.
+     */
+    void notifier(TypeNotification p_type, int p_droneId = 0, int p_colisId = 0, double p_poids = 0.0,
+                  MissionId p_missionId = 0);
+
+    /**
+     * \brief Conserve une notification portant sur une mission.
+     */
+    void notifier(TypeNotification p_type, const Mission& p_mission);
+
+    /**
+     * \brief Remet une notification au journal et à la sortie asynchrone.
+     */
+    void diffuser(const Notification& p_notification);
+
+    /**
+     * \brief Termine la mission en cours du drone de rang p_rangDrone.
+     */
+    bool terminerMissionDuDrone(std::size_t p_rangDrone);
+
+    /**
+     * \brief Mesure l'attente des colis d'une mission qui vient d'être planifiée.
+     */
+    void mesurerPlanification(std::size_t p_rangDrone, const Mission& p_mission);
+
+    /**
+     * \brief Mesure le vol et la durée de bout en bout d'une mission terminée.
+     */
+    void mesurerFin(std::size_t p_rangDrone, const Mission& p_mission);
+
+    /**
+     * \brief Passe la prochaine mission planifiée à EN_COURS.
+     */
+    Mission& demarrerProchaineMission();
+
+    /**
+     * \brief Écrit la ligne annonçant le lancement d'une mission.
+     */
+    void decrireLancement(const Mission& p_mission, std::ostream& p_flux) const;
+
+    /**
+     * \brief Termine une mission de m_missionsEnCours et libère son drone.
+     */
+    void completerMission(std::list<Mission>::iterator p_mission);
+
     /**
      * \brief Trouve un colis par son ID.
      */
     const Colis* trouverColisParId(int p_colisId) const;
 
-    std::vector<Drone> m_flotte;                      //!< La flotte de drones.
-    std::queue<Colis> m_colisEnAttente;               //!< File des colis à livrer.
-    std::vector<Mission> m_missionsPlanifiees;        //!< Liste des missions planifiées.
+    /**
+     * \brief Trouve le rang d'un drone dans m_flotte par son ID.
+     */
+    std::size_t trouverRangDrone(int p_droneId) const;
+
+    /**
+     * \brief Retourne le premier drone encore libre d'un masque d'éligibilité.
+     */
+    std::size_t premierDroneLibre(const std::uint64_t* p_masque, std::size_t p_nbMots) const;
+
+    /**
+     * \brief Retourne le poids au-delà duquel un colis est refusé.
+     */
+    double reqPoidsMaxAccepte() const;
+
+    /**
+     * \brief Signale un colis refusé parce que trop lourd.
+     */
+    void signalerColisTropLourd(const Colis& p_colis);
+
+    /**
+     * \brief Retourne la distance de la destination d'un colis, en km (0 : inconnue).
+     */
+    double distanceColis(const Colis& p_colis) const;
+
+    /**
+     * \brief Retourne la plus grande portée des drones qui peuvent porter p_poids.
+     */
+    double reqPorteeMax(double p_poids) const;
+
+    /**
+     * \brief Indique si le drone de rang p_rangDrone atteint la destination du colis.
+     */
+    bool estAPortee(std::size_t p_rangDrone, const Colis& p_colis) const;
+
+    /**
+     * \brief Refuse un colis qu'aucun drone assez puissant n'atteint; retourne true si c'est le cas.
+     */
+    bool refuserSiHorsPortee(const Colis& p_colis);
+
+    /**
+     * \brief Planifie les colis en attente en remplissant chaque drone (chargement multiple).
+     */
+    void planifierChargements();
+
+    /**
+     * \brief Calcule l'affectation de coût minimal d'une fenêtre de colis.
+     */
+    bool affecterFenetreOptimale(const std::vector<double>& p_poids, std::vector<std::size_t>& p_rangsDrones) const;
+
+    /**
+     * \brief Affecte un colis à un drone et ajoute la mission planifiée.
+     */
+    void planifierColis(std::size_t p_rangDrone, const Colis& p_colis);
+
+    /**
+     * \brief Tente de donner un colis différé à un drone qui vient de se libérer.
+     */
+    bool replanifierColisDiffere(std::size_t p_rangDrone);
+
+    /**
+     * \brief Fait emporter un colis par un drone et le retire des drones libres.
+     */
+    void affecterColis(std::size_t p_rangDrone, const Colis& p_colis);
+
+    /**
+     * \brief Fait livrer un drone et le remet parmi les drones libres.
+     */
+    void libererDrone(std::size_t p_rangDrone);
+
+    FlotteSoA m_flotte;                               //!< La flotte de drones, rangée par attribut.
+    FileContigue<std::size_t> m_colisEnAttente;       //!< File des colis à livrer (rangs dans m_tousLesColis).
+    ColisDifferes m_colisDifferes;                    //!< Colis sans drone, en mode DIFFERE.
+    FileContigue<Mission> m_missionsPlanifiees;       //!< File FIFO des missions planifiées, pas encore lancées.
+    std::list<Mission> m_missionsEnCours;             //!< Missions en cours, dans l'ordre de lancement.
     std::list<Mission> m_journalMissions;             //!< Journal des missions complétées.
-    std::vector<Colis> m_tousLesColis;                //!< Tous les colis chargés du scénario.
-    std::stack<std::string> m_notifications;          //!< Pile LIFO des notifications système.
+    std::list<Mission> m_missionsReservees;           //!< Un nœud libre par drone sans mission en cours, pris au lancement.
+    std::deque<Colis> m_tousLesColis;                 //!< Seul propriétaire des colis; adresses stables à l'ajout.
+    JournalNotifications m_notifications;             //!< Journal circulaire des notifications système.
+    bool m_notificationsActives;                      //!< false : le journal ne reçoit rien.
+    SortieAsynchrone* m_sortieAsynchrone;             //!< Sortie des notifications en arrière-plan (nullptr : aucune).
+    std::ostream* m_sortie;                           //!< Destination des messages (std::cout par défaut).
+    std::vector<std::list<Mission>::iterator> m_missionParDrone; //!< Rang de drone → mission en cours (end() : aucune).
+    std::unordered_map<MissionId, std::list<Mission>::iterator> m_missionsEnCoursParId; //!< ID → mission en cours.
+    std::vector<decltype(m_missionsEnCoursParId)::node_type> m_noeudsParIdLibres; //!< Nœuds de m_missionsEnCoursParId à réutiliser.
+    std::vector<const Mission*> m_lancements;         //!< Tampon réutilisé par lancerMissions.
+    MissionId m_prochainIdMission;                    //!< ID de la prochaine mission planifiée.
+    RoueTemporelle m_echeances;                       //!< Minuteries de fin de mission (valeur : rang du drone).
+    std::vector<RoueTemporelle::Minuterie> m_minuterieParDrone; //!< Rang de drone → minuterie de fin de mission.
+    unsigned int m_nbFilsChargement;                  //!< Fils d'analyse du scénario (1 : séquentiel).
+    IndexIdentifiants m_indexDrones;                  //!< ID de drone → rang dans m_flotte.
+    IndexIdentifiants m_indexColis;                   //!< ID de colis → rang dans m_tousLesColis.
+    CatalogueModeles m_catalogue;                     //!< Capacités par modèle de drone.
+    double m_poidsMaxColis;                           //!< Limite de poids imposée aux colis.
+    double m_chargeMaxFlotte;                         //!< Plus grande charge utile de la flotte.
+    std::size_t m_nbColisRefuses;                     //!< Colis refusés parce que trop lourds.
+    std::size_t m_nbColisHorsPortee;                  //!< Colis refusés, hors de portée.
+    std::vector<double> m_distancesDestinations;      //!< Destination (identifiant dans TableChaines) → km (0 : inconnue).
+    std::vector<double> m_porteesDrones;              //!< Rang de drone → distance aller couverte, en km.
+    std::vector<std::pair<double, double>> m_porteesParCharge; //!< (charge utile, plus grande portée à charge au moins égale), par charge croissante.
+    IndexDronesLibres m_dronesLibres;                 //!< Drones libres indexés par charge utile.
+    StrategieAffectation m_strategie;                 //!< Règle de choix du drone.
+    ModePlanification m_mode;                         //!< Comportement face à un colis sans drone.
+    NoyauEligibilite m_noyau;                         //!< Noyau vectoriel de la stratégie VECTORIELLE.
+    std::size_t m_tailleFenetreOptimale;              //!< Colis par couplage de la stratégie OPTIMALE.
+    std::chrono::microseconds m_budgetOptimal;        //!< Temps alloué à chaque couplage.
+    bool m_chargementMultiple;                        //!< Plusieurs colis par sortie.
+    std::vector<std::chrono::steady_clock::time_point> m_arriveeColis;    //!< Arrivée, par rang de colis.
+    std::vector<std::chrono::steady_clock::time_point> m_planificationParDrone; //!< Planification de la mission du drone.
+    std::vector<std::chrono::steady_clock::time_point> m_lancementParDrone;     //!< Lancement de la mission du drone.
+    std::array<HistogrammeLatences, NB_ETAPES_LIVRAISON> m_latences;    //!< Durées, par EtapeLivraison.
+
+    static const std::size_t TAILLE_LOT_VECTORIEL = 8; //!< Colis traités par passe du noyau.
 };
 
 } // namespace microdrone
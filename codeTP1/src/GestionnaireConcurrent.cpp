@@ -0,0 +1,474 @@
+/**
+ * \file GestionnaireConcurrent.cpp
+ * \brief Implantation du gestionnaire partagé entre plusieurs fils.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "GestionnaireConcurrent.h"
+#include <algorithm>
+#include <stdexcept>
+#include "CatalogueModeles.h"
+#include "ContratException.h"
+#include "LecteurScenario.h"
+#include "TableChaines.h"
+#include "Traceur.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+const size_t GestionnaireConcurrent::CAPACITE_DEFAUT = 65536;
+
+namespace
+{
+size_t puissanceDeDeuxSuperieure(size_t p_nb)
+{
+    size_t puissance = 1;
+    while (puissance < p_nb)
+        puissance <<= 1;
+    return puissance;
+}
+}
+
+    /**
+     * \brief Construit un gestionnaire sans drone.
+     *
+     * \param[in] p_capaciteColis Le nombre maximal de colis reçus en attente.
+     *
+     * \pre p_capaciteColis est une puissance de deux non nulle.
+     */
+GestionnaireConcurrent::GestionnaireConcurrent(size_t p_capaciteColis):m_chargeMaxFlotte(0.0),
+    m_colisEnAttente(new FileMpmc<ColisSoumis>(p_capaciteColis)), m_premierIdMission(1), m_pasIdMission(1),
+    m_gel(nullptr), m_prochainIdMission(1),
+    m_nbMissionsEnCours(0), m_nbMissionsTerminees(0), m_nbColisDifferes(0), m_nbColisRefuses(0)
+{
+}
+
+    /**
+     * \brief Charge la flotte et les colis d'un scénario, comme Gestionnaire::chargerScenario.
+     *
+     * Les colis du scénario sont reçus dans l'ordre du fichier; la file
+     * d'attente est agrandie au besoin pour tous les contenir.
+     *
+     * \param[in] p_nomFichier Le fichier de scénario, texte ou binaire.
+     *
+     * \pre Aucun autre fil n'utilise le gestionnaire.
+     *
+     * \throw invalid_argument si le nom du fichier est vide.
+     * \throw runtime_error si le fichier est illisible ou mal formé.
+     */
+void GestionnaireConcurrent::chargerScenario(const string& p_nomFichier)
+{
+    TRACER_PORTEE("chargerScenario");
+    if (p_nomFichier.empty())
+        throw invalid_argument("Le nom du fichier ne peut pas être vide");
+
+    LecteurScenario lecteur(p_nomFichier);
+    lecteur.analyser();
+
+    const size_t capacite = puissanceDeDeuxSuperieure(max(m_colisEnAttente->capacite(), lecteur.reqColis().size()));
+    m_colisEnAttente.reset(new FileMpmc<ColisSoumis>(capacite));
+    chargerFlotte(lireFlotte(lecteur));
+    for (const EnregistrementColis& colis : lecteur.reqColis())
+        soumettreColis(colis.id, colis.poids);
+}
+
+    /**
+     * \brief Remplace la flotte, tous ses drones libres, et vide les files et les compteurs.
+     *
+     * \param[in] p_drones Les drones de la nouvelle flotte.
+     *
+     * \pre Aucun autre fil n'utilise le gestionnaire.
+     */
+void GestionnaireConcurrent::chargerFlotte(vector<DroneAtomique> p_drones)
+{
+    m_drones = move(p_drones);
+    m_indexDrones.vider();
+    m_indexDrones.reserver(m_drones.size());
+    m_chargeMaxFlotte = 0.0;
+    for (size_t rang = 0; rang < m_drones.size(); ++rang)
+    {
+        m_indexDrones.ajouter(m_drones[rang].reqId(), rang);
+        m_chargeMaxFlotte = max(m_chargeMaxFlotte, m_drones[rang].reqChargeMax());
+    }
+    construireClasses();
+
+    m_colisEnAttente.reset(new FileMpmc<ColisSoumis>(m_colisEnAttente->capacite()));
+    m_colisDifferes.clear();
+    m_prochainIdMission = m_premierIdMission;
+    m_nbMissionsEnCours = 0;
+    m_nbMissionsTerminees = 0;
+    m_nbColisDifferes = 0;
+    m_nbColisRefuses = 0;
+}
+
+    /**
+     * \brief Construit les drones d'un scénario analysé.
+     *
+     * Un drone sans charge utile explicite prend celle de son modèle.
+     *
+     * \param[in] p_lecteur Le scénario, déjà analysé.
+     * \return Les drones, dans l'ordre du fichier.
+     *
+     * \throw runtime_error si un drone est défini deux fois ou a un modèle sans
+     *        charge utile connue.
+     */
+vector<DroneAtomique> GestionnaireConcurrent::lireFlotte(const LecteurScenario& p_lecteur)
+{
+    TableChaines& table = TableChaines::instance();
+    CatalogueModeles catalogue;
+    for (const EnregistrementModele& modele : p_lecteur.reqModeles())
+        catalogue.ajouter(table.interner(modele.nom), CapaciteModele{modele.chargeMax, modele.vitesse,
+                                                                       modele.autonomie, modele.rotation});
+
+    vector<DroneAtomique> drones;
+    IndexIdentifiants ids;
+    drones.reserve(p_lecteur.reqDrones().size());
+    ids.reserver(p_lecteur.reqDrones().size());
+    for (const EnregistrementDrone& drone : p_lecteur.reqDrones())
+    {
+        if (!ids.ajouter(drone.id, drones.size()))
+            throw runtime_error("Scénario mal formé à l'octet " + to_string(drone.octet)
+                                + " : drone #" + to_string(drone.id) + " défini deux fois");
+        double chargeMax = drone.chargeMax;
+        if (chargeMax == 0.0)
+        {
+            const CapaciteModele* capacite = catalogue.trouver(table.interner(drone.modele));
+            if (capacite == nullptr)
+                throw runtime_error("Scénario mal formé à l'octet " + to_string(drone.octet)
+                                    + " : modèle " + string(drone.modele) + " sans charge utile connue");
+            chargeMax = capacite->chargeMax;
+        }
+        drones.emplace_back(drone.id, chargeMax);
+    }
+    return drones;
+}
+
+    /**
+     * \brief Numérote les missions à partir de p_premier, de p_pas en p_pas.
+     *
+     * Des gestionnaires qui partagent un même p_pas et ont chacun un
+     * p_premier distinct, entre 1 et p_pas, n'attribuent jamais le même
+     * identifiant. Prend effet au prochain chargement de la flotte.
+     *
+     * \pre p_premier > 0
+     * \pre p_pas > 0
+     * \pre Aucun autre fil n'utilise le gestionnaire.
+     */
+void GestionnaireConcurrent::definirNumerotationMissions(MissionId p_premier, MissionId p_pas)
+{
+    PRECONDITION(p_premier > 0);
+    PRECONDITION(p_pas > 0);
+    m_premierIdMission = p_premier;
+    m_pasIdMission = p_pas;
+    m_prochainIdMission = p_premier;
+}
+
+    /**
+     * \brief Soumet les déplacements de colis et de drones à un gel.
+     *
+     * Chaque prise d'un colis en attente, reprise des colis différés et fin
+     * de mission se déclare alors dans reqOperations et, si le gel est posé,
+     * attend sa levée pour commencer. Les réceptions, qui ajoutent
+     * un colis sans en déplacer, ne sont pas suspendues.
+     *
+     * \param[in] p_gel Le gel, qui doit survivre au gestionnaire; nullptr le retire.
+     *
+     * \pre Aucun autre fil n'utilise le gestionnaire.
+     */
+void GestionnaireConcurrent::definirGel(GelOperations* p_gel)
+{
+    m_gel = p_gel;
+}
+
+    /**
+     * \brief Reçoit un colis, en O(1) et sans verrou.
+     *
+     * \param[in] p_id L'identifiant du colis.
+     * \param[in] p_poids Le poids du colis en kg.
+     *
+     * \pre p_id > 0
+     * \pre p_poids > 0.0
+     *
+     * \return false si la file d'attente est pleine : le colis n'est pas reçu.
+     */
+bool GestionnaireConcurrent::soumettreColis(int p_id, double p_poids)
+{
+    PRECONDITION(p_id > 0);
+    PRECONDITION(p_poids > 0.0);
+    ColisSoumis colis;
+    colis.id = p_id;
+    colis.poids = p_poids;
+    return m_colisEnAttente->ajouter(colis);
+}
+
+    /**
+     * \brief Affecte des colis en attente aux drones libres.
+     *
+     * Les colis différés sont repris d'abord, puis les colis reçus dans
+     * l'ordre d'arrivée. Un colis plus lourd que tout drone est refusé; un
+     * colis sans drone libre assez puissant est différé. La planification
+     * s'arrête dès que tous les drones sont en mission, sans vider la file.
+     *
+     * \param[in] p_nbMax Le nombre maximal de colis affectés.
+     * \return Le nombre de missions lancées.
+     */
+size_t GestionnaireConcurrent::planifierMissions(size_t p_nbMax)
+{
+    TRACER_PORTEE("planifierMissions");
+    size_t nbAffectes = replanifierDifferes(p_nbMax);
+    ColisSoumis colis;
+    while (nbAffectes < p_nbMax && m_nbMissionsEnCours.load(memory_order_relaxed) < m_drones.size())
+    {
+        GelOperations::Operation operation(m_gel, m_operations);
+        if (!m_colisEnAttente->retirer(colis))
+            break;
+        if (colis.poids > m_chargeMaxFlotte)
+            m_nbColisRefuses.fetch_add(1, memory_order_relaxed);
+        else if (affecter(colis))
+            nbAffectes++;
+        else
+            differer(colis);
+    }
+    return nbAffectes;
+}
+
+    /**
+     * \brief Termine la mission en cours d'un drone et le rend disponible.
+     *
+     * \param[in] p_droneId L'identifiant du drone.
+     * \return false si le drone est inconnu, n'a pas de mission en cours, ou
+     *         si un autre fil termine déjà cette mission.
+     */
+bool GestionnaireConcurrent::terminerMission(int p_droneId)
+{
+    MissionId missionId;
+    return terminerMission(p_droneId, missionId);
+}
+
+    /**
+     * \brief Termine la mission en cours d'un drone et en donne l'identifiant.
+     *
+     * \param[in] p_droneId L'identifiant du drone.
+     * \param[out] p_missionId L'identifiant reçu par le drone à l'affectation,
+     *             inchangé si aucune mission n'est terminée.
+     * \return false si le drone est inconnu, n'a pas de mission en cours, ou
+     *         si un autre fil termine déjà cette mission.
+     */
+bool GestionnaireConcurrent::terminerMission(int p_droneId, MissionId& p_missionId)
+{
+    TRACER_PORTEE("terminerMission");
+    const size_t rang = m_indexDrones.trouver(p_droneId);
+    if (rang == IndexIdentifiants::AUCUN || m_drones[rang].reqEtat() == DroneEtat::LIBRE)
+        return false;
+    GelOperations::Operation operation(m_gel, m_operations);
+    int colisId;
+    if (!m_drones[rang].livrer(p_missionId, colisId))
+        return false;
+    m_nbMissionsTerminees.fetch_add(1, memory_order_relaxed);
+    m_nbMissionsEnCours.fetch_sub(1, memory_order_relaxed);
+    [[maybe_unused]] const bool remis = m_classes[m_classeParDrone[rang]].libres->ajouter(static_cast<uint32_t>(rang));
+    ASSERTION(remis);
+    return true;
+}
+
+    /**
+     * \brief Prend des colis en attente chez un autre gestionnaire et les lance sur ses propres drones.
+     *
+     * Les colis sont pris en tête de la file de p_victime, les plus anciens
+     * d'abord, tant qu'il reste ici un drone libre. Un colis qu'aucun drone
+     * libre d'ici ne peut porter est rendu à p_victime, en queue de sa file
+     * (ou parmi ses colis différés si elle est pleine), et le vol s'arrête.
+     * Les colis différés de p_victime ne sont jamais pris.
+     *
+     * \param[in,out] p_victime Le gestionnaire dont les colis sont pris.
+     * \param[in] p_nbMax Le nombre maximal de colis pris.
+     * \return Le nombre de missions lancées.
+     *
+     * \pre &p_victime != this
+     */
+size_t GestionnaireConcurrent::volerColis(GestionnaireConcurrent& p_victime, size_t p_nbMax)
+{
+    TRACER_PORTEE("volerColis");
+    PRECONDITION(&p_victime != this);
+    size_t nbAffectes = 0;
+    ColisSoumis colis;
+    while (nbAffectes < p_nbMax && m_nbMissionsEnCours.load(memory_order_relaxed) < m_drones.size())
+    {
+        GelOperations::Operation operation(m_gel, m_operations);
+        if (!p_victime.m_colisEnAttente->retirer(colis))
+            break;
+        if (colis.poids > m_chargeMaxFlotte || !affecter(colis))
+        {
+            p_victime.rendre(colis);
+            break;
+        }
+        nbAffectes++;
+    }
+    return nbAffectes;
+}
+
+    /**
+     * \brief Retourne les compteurs de la flotte et des files.
+     *
+     * Chaque compteur est exact au moment de sa lecture, mais pendant que
+     * d'autres fils travaillent, ils ne sont pas lus au même instant (voir
+     * GelOperations pour un relevé cohérent).
+     * nbDrones == dronesDisponibles + dronesEnMission tient toujours; une
+     * mission est lancée dès son affectation (missionsPlanifiees vaut 0).
+     */
+StatistiquesFlotte GestionnaireConcurrent::reqCompteurs() const
+{
+    StatistiquesFlotte compteurs;
+    compteurs.nbDrones = m_drones.size();
+    compteurs.missionsEnCours = min(m_nbMissionsEnCours.load(memory_order_relaxed), compteurs.nbDrones);
+    compteurs.dronesEnMission = compteurs.missionsEnCours;
+    compteurs.dronesDisponibles = compteurs.nbDrones - compteurs.dronesEnMission;
+    compteurs.missionsTerminees = m_nbMissionsTerminees.load(memory_order_relaxed);
+    compteurs.colisEnAttente = m_colisEnAttente->taille();
+    compteurs.colisDifferes = m_nbColisDifferes.load(memory_order_relaxed);
+    compteurs.colisRefuses = m_nbColisRefuses.load(memory_order_relaxed);
+    return compteurs;
+}
+
+double GestionnaireConcurrent::reqChargeMaxFlotte() const
+{
+    return m_chargeMaxFlotte;
+}
+
+size_t GestionnaireConcurrent::reqNbDronesLibres() const
+{
+    const size_t enMission = m_nbMissionsEnCours.load(memory_order_relaxed);
+    return enMission < m_drones.size() ? m_drones.size() - enMission : 0;
+}
+
+size_t GestionnaireConcurrent::reqNbColisEnAttente() const
+{
+    return m_colisEnAttente->taille();
+}
+
+const GelOperations::Compteur& GestionnaireConcurrent::reqOperations() const
+{
+    return m_operations;
+}
+
+    /**
+     * \brief Range les drones par charge utile, une file de drones libres par valeur distincte.
+     */
+void GestionnaireConcurrent::construireClasses()
+{
+    vector<double> charges;
+    charges.reserve(m_drones.size());
+    for (const DroneAtomique& drone : m_drones)
+        charges.push_back(drone.reqChargeMax());
+    sort(charges.begin(), charges.end());
+
+    m_classes.clear();
+    vector<size_t> tailles;
+    for (size_t i = 0; i < charges.size(); ++i)
+    {
+        if (i == 0 || charges[i] != charges[i - 1])
+        {
+            m_classes.push_back(ClasseCapacite{charges[i], nullptr});
+            tailles.push_back(0);
+        }
+        tailles.back()++;
+    }
+    for (size_t c = 0; c < m_classes.size(); ++c)
+        m_classes[c].libres.reset(new FileMpmc<uint32_t>(puissanceDeDeuxSuperieure(tailles[c])));
+
+    m_classeParDrone.resize(m_drones.size());
+    for (size_t rang = 0; rang < m_drones.size(); ++rang)
+    {
+        auto classe = lower_bound(m_classes.begin(), m_classes.end(), m_drones[rang].reqChargeMax(),
+                                  [](const ClasseCapacite& p_classe, double p_charge)
+                                  { return p_classe.chargeMax < p_charge; });
+        m_classeParDrone[rang] = static_cast<uint32_t>(classe - m_classes.begin());
+        classe->libres->ajouter(static_cast<uint32_t>(rang));
+    }
+}
+
+    /**
+     * \brief Lance une mission pour un colis sur le plus petit drone libre qui peut le porter.
+     *
+     * \param[in] p_colis Le colis.
+     * \return false si aucun drone assez puissant n'est libre.
+     */
+bool GestionnaireConcurrent::affecter(const ColisSoumis& p_colis)
+{
+    auto premiere = lower_bound(m_classes.begin(), m_classes.end(), p_colis.poids,
+                                [](const ClasseCapacite& p_classe, double p_poids)
+                                { return p_classe.chargeMax < p_poids; });
+    for (auto classe = premiere; classe != m_classes.end(); ++classe)
+    {
+        uint32_t rang;
+        if (!classe->libres->retirer(rang))
+            continue;
+        // Compté avant la publication de EN_VOL, pour qu'un rapport de fin
+        // ne puisse pas décrémenter le compteur avant cet incrément.
+        m_nbMissionsEnCours.fetch_add(1, memory_order_relaxed);
+        const MissionId id = m_prochainIdMission.fetch_add(m_pasIdMission, memory_order_relaxed);
+        [[maybe_unused]] const bool emporte = m_drones[rang].emporter(id, p_colis.id, p_colis.poids);
+        ASSERTION(emporte);
+        return true;
+    }
+    return false;
+}
+
+void GestionnaireConcurrent::differer(const ColisSoumis& p_colis)
+{
+    lock_guard<mutex> verrou(m_verrouDifferes);
+    m_colisDifferes.push_back(p_colis);
+    m_nbColisDifferes.fetch_add(1, memory_order_relaxed);
+}
+
+    /**
+     * \brief Remet en file un colis pris par un autre gestionnaire, ou le diffère si la file est pleine.
+     */
+void GestionnaireConcurrent::rendre(const ColisSoumis& p_colis)
+{
+    if (!m_colisEnAttente->ajouter(p_colis))
+        differer(p_colis);
+}
+
+    /**
+     * \brief Reprend les colis différés, dans leur ordre, sans garder le verrou pendant l'affectation.
+     *
+     * Les colis non examinés, une fois p_nbMax colis affectés, restent
+     * différés à leur place.
+     *
+     * \param[in] p_nbMax Le nombre maximal de colis affectés.
+     * \return Le nombre de colis affectés.
+     */
+size_t GestionnaireConcurrent::replanifierDifferes(size_t p_nbMax)
+{
+    if (p_nbMax == 0 || m_nbColisDifferes.load(memory_order_relaxed) == 0)
+        return 0;
+
+    // Les colis repris restent comptés différés jusqu'à la fin : un seul déplacement.
+    GelOperations::Operation operation(m_gel, m_operations);
+    deque<ColisSoumis> differes;
+    {
+        lock_guard<mutex> verrou(m_verrouDifferes);
+        differes.swap(m_colisDifferes);
+    }
+    size_t nbAffectes = 0;
+    deque<ColisSoumis> restants;
+    auto colis = differes.begin();
+    for (; colis != differes.end() && nbAffectes < p_nbMax; ++colis)
+    {
+        if (affecter(*colis))
+            nbAffectes++;
+        else
+            restants.push_back(*colis);
+    }
+    restants.insert(restants.end(), colis, differes.end());
+    lock_guard<mutex> verrou(m_verrouDifferes);
+    m_colisDifferes.insert(m_colisDifferes.begin(), restants.begin(), restants.end());
+    m_nbColisDifferes.fetch_sub(nbAffectes, memory_order_relaxed);
+    return nbAffectes;
+}
+
+} // namespace microdrone
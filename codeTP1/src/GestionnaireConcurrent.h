@@ -0,0 +1,183 @@
+/**
+ * \file GestionnaireConcurrent.h
+ * \brief Déclaration du gestionnaire partagé entre fils de réception, de planification et de fin de mission.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef GESTIONNAIRECONCURRENT_H_DEJA_INCLU
+#define GESTIONNAIRECONCURRENT_H_DEJA_INCLU
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "DroneAtomique.h"
+#include "FileMpmc.h"
+#include "GelOperations.h"
+#include "Gestionnaire.h"
+#include "IndexIdentifiants.h"
+#include "LecteurScenario.h"
+
+namespace microdrone
+{
+
+/**
+ * \brief Colis reçu par GestionnaireConcurrent, en attente d'un drone.
+ */
+struct ColisSoumis
+{
+    int id = 0;             //!< Identifiant du colis.
+    double poids = 0.0;     //!< Poids en kg.
+};
+
+/**
+ * \class GestionnaireConcurrent
+ * \brief Variante de Gestionnaire dont la réception des colis, la
+ *        planification et les fins de mission peuvent venir de fils différents.
+ *
+ * Les colis reçus passent par une FileMpmc, sans verrou. Les drones libres
+ * sont rangés par classe de charge utile, chacune dans sa propre FileMpmc :
+ * un planificateur prend le plus petit drone libre qui peut porter le colis
+ * (meilleur ajustement par classe) et le fait emporter par une transition
+ * atomique de DroneAtomique; un rapport de fin le fait livrer de même, puis
+ * le remet dans sa file. Seuls les colis différés, faute de drone assez
+ * puissant, passent par un verrou, hors du chemin courant.
+ *
+ * Une mission est lancée dès son affectation. Le gestionnaire n'écrit aucun
+ * message ni notification : son état se lit par reqCompteurs.
+ *
+ * Avec un gel (definirGel), chaque déplacement d'un colis ou d'un drone
+ * entre deux compteurs se déclare dans reqOperations : un relevé peut alors
+ * lire des compteurs qui comptent chaque colis une fois (voir GelOperations).
+ */
+class GestionnaireConcurrent
+{
+public:
+    static const std::size_t CAPACITE_DEFAUT;   //!< Colis en attente, au plus.
+
+    /**
+     * \brief Construit un gestionnaire sans drone.
+     */
+    explicit GestionnaireConcurrent(std::size_t p_capaciteColis = CAPACITE_DEFAUT);
+
+    GestionnaireConcurrent(const GestionnaireConcurrent&) = delete;
+    GestionnaireConcurrent& operator=(const GestionnaireConcurrent&) = delete;
+
+    /**
+     * \brief Charge la flotte et les colis d'un scénario, avant l'arrivée des fils.
+     */
+    void chargerScenario(const std::string& p_nomFichier);
+
+    /**
+     * \brief Remplace la flotte et vide les files, avant l'arrivée des fils.
+     */
+    void chargerFlotte(std::vector<DroneAtomique> p_drones);
+
+    /**
+     * \brief Construit les drones d'un scénario analysé, charges utiles résolues par modèle.
+     */
+    static std::vector<DroneAtomique> lireFlotte(const LecteurScenario& p_lecteur);
+
+    /**
+     * \brief Numérote les missions p_premier, p_premier + p_pas, p_premier + 2 * p_pas, etc.
+     */
+    void definirNumerotationMissions(MissionId p_premier, MissionId p_pas);
+
+    /**
+     * \brief Soumet les déplacements de colis et de drones à un gel (nullptr : aucun).
+     */
+    void definirGel(GelOperations* p_gel);
+
+    /**
+     * \brief Reçoit un colis; peut être appelé de plusieurs fils en même temps.
+     */
+    bool soumettreColis(int p_id, double p_poids);
+
+    /**
+     * \brief Affecte des colis en attente aux drones libres; plusieurs fils peuvent planifier.
+     */
+    std::size_t planifierMissions(std::size_t p_nbMax = std::numeric_limits<std::size_t>::max());
+
+    /**
+     * \brief Termine la mission en cours d'un drone; peut être appelé de plusieurs fils.
+     */
+    bool terminerMission(int p_droneId);
+
+    /**
+     * \brief Termine la mission en cours d'un drone et en donne l'identifiant.
+     */
+    bool terminerMission(int p_droneId, MissionId& p_missionId);
+
+    /**
+     * \brief Prend des colis en attente chez p_victime et les lance sur ses propres drones libres.
+     */
+    std::size_t volerColis(GestionnaireConcurrent& p_victime, std::size_t p_nbMax);
+
+    /**
+     * \brief Retourne les compteurs de la flotte et des files.
+     */
+    StatistiquesFlotte reqCompteurs() const;
+
+    /**
+     * \brief Retourne la plus grande charge utile de la flotte.
+     */
+    double reqChargeMaxFlotte() const;
+
+    /**
+     * \brief Retourne le nombre de drones sans mission, approximatif si d'autres fils travaillent.
+     */
+    std::size_t reqNbDronesLibres() const;
+
+    /**
+     * \brief Retourne le nombre de colis reçus pas encore affectés ni différés.
+     */
+    std::size_t reqNbColisEnAttente() const;
+
+    /**
+     * \brief Retourne les déplacements de colis et de drones commencés et terminés, comptés sous gel.
+     */
+    const GelOperations::Compteur& reqOperations() const;
+
+private:
+    struct ClasseCapacite
+    {
+        double chargeMax;                                   //!< Charge utile des drones de la classe.
+        std::unique_ptr<FileMpmc<std::uint32_t>> libres;    //!< Rangs des drones libres.
+    };
+
+    void construireClasses();
+    bool affecter(const ColisSoumis& p_colis);
+    void differer(const ColisSoumis& p_colis);
+    void rendre(const ColisSoumis& p_colis);
+    std::size_t replanifierDifferes(std::size_t p_nbMax);
+
+    std::vector<DroneAtomique> m_drones;                    //!< Flotte, par rang.
+    std::vector<std::uint32_t> m_classeParDrone;            //!< Classe de capacité de chaque drone.
+    std::vector<ClasseCapacite> m_classes;                  //!< Classes par charge utile croissante.
+    IndexIdentifiants m_indexDrones;                        //!< Identifiant de drone → rang.
+    double m_chargeMaxFlotte;                               //!< Plus grande charge utile.
+    std::unique_ptr<FileMpmc<ColisSoumis>> m_colisEnAttente;    //!< Colis reçus, pas encore affectés.
+    MissionId m_premierIdMission;                           //!< Identifiant de la première mission.
+    MissionId m_pasIdMission;                               //!< Écart entre deux identifiants attribués.
+    GelOperations* m_gel;                                   //!< Gel des déplacements (nullptr : aucun).
+
+    std::mutex m_verrouDifferes;                            //!< Protège m_colisDifferes.
+    std::deque<ColisSoumis> m_colisDifferes;                //!< Colis sans drone assez puissant de libre.
+
+    alignas(64) std::atomic<MissionId> m_prochainIdMission; //!< Prochain identifiant attribué.
+    alignas(64) std::atomic<std::size_t> m_nbMissionsEnCours;   //!< Drones réservés ou en vol.
+    alignas(64) std::atomic<std::size_t> m_nbMissionsTerminees; //!< Missions livrées.
+    std::atomic<std::size_t> m_nbColisDifferes;             //!< Colis de m_colisDifferes, y compris en cours de reprise.
+    std::atomic<std::size_t> m_nbColisRefuses;              //!< Colis plus lourds que tout drone.
+    GelOperations::Compteur m_operations;                   //!< Déplacements, comptés sous gel seulement.
+};
+
+} // namespace microdrone
+
+#endif // GESTIONNAIRECONCURRENT_H_DEJA_INCLU
@@ -0,0 +1,398 @@
+/**
+ * \file GestionnaireFragmente.cpp
+ * \brief Implantation du gestionnaire réparti en fragments avec vol de travail.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "GestionnaireFragmente.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include "ContratException.h"
+#include "LecteurScenario.h"
+#include "Traceur.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+const size_t GestionnaireFragmente::CAPACITE_DEFAUT = 16384;
+
+namespace
+{
+const size_t TAILLE_LOT = 256;          // Colis affectés par passe d'un fil de planification.
+const size_t PASSES_AVANT_SOMMEIL = 64; // Passes vides où le fil cède la main avant de dormir.
+const size_t ESSAIS_SANS_GEL = 8;       // Relevés sans gel tentés avant de geler les déplacements.
+
+size_t puissanceDeDeuxSuperieure(size_t p_nb)
+{
+    size_t puissance = 1;
+    while (puissance < p_nb)
+        puissance <<= 1;
+    return puissance;
+}
+}
+
+    /**
+     * \brief Construit un gestionnaire sans drone.
+     *
+     * \param[in] p_nbFragments Le nombre de fragments, donc de fils de planification.
+     * \param[in] p_capaciteColis Le nombre maximal de colis en attente dans chaque fragment.
+     *
+     * \pre p_nbFragments > 0
+     * \pre p_capaciteColis est une puissance de deux non nulle.
+     */
+GestionnaireFragmente::GestionnaireFragmente(size_t p_nbFragments, size_t p_capaciteColis):m_chargeMaxFlotte(0.0),
+    m_capaciteColis(p_capaciteColis), m_actif(false), m_operationsReleve(p_nbFragments, 0)
+{
+    PRECONDITION(p_nbFragments > 0);
+    m_fragments.reserve(p_nbFragments);
+    for (size_t f = 0; f < p_nbFragments; ++f)
+    {
+        m_fragments.emplace_back(new Fragment);
+        m_fragments[f]->gestionnaire.reset(new GestionnaireConcurrent(m_capaciteColis));
+        m_fragments[f]->gestionnaire->definirNumerotationMissions(f + 1, p_nbFragments);
+        m_fragments[f]->gestionnaire->definirGel(&m_gel);
+    }
+}
+
+GestionnaireFragmente::~GestionnaireFragmente()
+{
+    arreter();
+}
+
+    /**
+     * \brief Charge la flotte et les colis d'un scénario.
+     *
+     * La file de chaque fragment est agrandie au besoin pour contenir deux
+     * fois sa part des colis du scénario.
+     *
+     * \param[in] p_nomFichier Le fichier de scénario, texte ou binaire.
+     *
+     * \pre Les fils de planification sont arrêtés et aucun autre fil n'utilise le gestionnaire.
+     *
+     * \throw invalid_argument si le nom du fichier est vide.
+     * \throw runtime_error si le fichier est illisible ou mal formé.
+     */
+void GestionnaireFragmente::chargerScenario(const string& p_nomFichier)
+{
+    TRACER_PORTEE("chargerScenario");
+    if (p_nomFichier.empty())
+        throw invalid_argument("Le nom du fichier ne peut pas être vide");
+
+    LecteurScenario lecteur(p_nomFichier);
+    lecteur.analyser();
+
+    const size_t part = (lecteur.reqColis().size() + m_fragments.size() - 1) / m_fragments.size();
+    m_capaciteColis = puissanceDeDeuxSuperieure(max(m_capaciteColis, 2 * part));
+    chargerFlotte(GestionnaireConcurrent::lireFlotte(lecteur));
+    for (const EnregistrementColis& colis : lecteur.reqColis())
+        soumettreColis(colis.id, colis.poids);
+}
+
+    /**
+     * \brief Répartit une nouvelle flotte entre les fragments, tous ses drones libres.
+     *
+     * Les drones sont triés par charge utile puis distribués à tour de rôle :
+     * chaque fragment reçoit la même proportion de chaque capacité, à un
+     * drone près. Les files, les compteurs et la numérotation des missions
+     * repartent de zéro.
+     *
+     * \param[in] p_drones Les drones de la nouvelle flotte.
+     *
+     * \pre Les fils de planification sont arrêtés et aucun autre fil n'utilise le gestionnaire.
+     */
+void GestionnaireFragmente::chargerFlotte(vector<DroneAtomique> p_drones)
+{
+    PRECONDITION(!m_actif.load());
+    const size_t nbFragments = m_fragments.size();
+
+    vector<size_t> ordre(p_drones.size());
+    iota(ordre.begin(), ordre.end(), size_t(0));
+    stable_sort(ordre.begin(), ordre.end(), [&p_drones](size_t p_a, size_t p_b)
+                { return p_drones[p_a].reqChargeMax() < p_drones[p_b].reqChargeMax(); });
+
+    vector<vector<DroneAtomique>> parts(nbFragments);
+    for (vector<DroneAtomique>& drones : parts)
+        drones.reserve(p_drones.size() / nbFragments + 1);
+    m_indexDrones.vider();
+    m_indexDrones.reserver(p_drones.size());
+    m_fragmentParDrone.assign(p_drones.size(), 0);
+    m_chargeMaxFlotte = 0.0;
+    for (size_t i = 0; i < ordre.size(); ++i)
+    {
+        const size_t rang = ordre[i];
+        const size_t fragment = i % nbFragments;
+        m_indexDrones.ajouter(p_drones[rang].reqId(), rang);
+        m_fragmentParDrone[rang] = static_cast<uint32_t>(fragment);
+        m_chargeMaxFlotte = max(m_chargeMaxFlotte, p_drones[rang].reqChargeMax());
+        parts[fragment].push_back(move(p_drones[rang]));
+    }
+
+    for (size_t f = 0; f < nbFragments; ++f)
+    {
+        Fragment& fragment = *m_fragments[f];
+        fragment.gestionnaire.reset(new GestionnaireConcurrent(m_capaciteColis));
+        fragment.gestionnaire->definirNumerotationMissions(f + 1, nbFragments);
+        fragment.gestionnaire->definirGel(&m_gel);
+        fragment.gestionnaire->chargerFlotte(move(parts[f]));
+        fragment.nbColisVoles = 0;
+    }
+}
+
+    /**
+     * \brief Reçoit un colis dans le fragment id % nbFragments, en O(1) et sans verrou.
+     *
+     * Si ce fragment n'a aucun drone assez puissant, ou si sa file est pleine,
+     * le colis va au fragment suivant qui peut le porter. Un colis plus lourd
+     * que tout drone reste dans le premier fragment, qui le refuse.
+     *
+     * \param[in] p_id L'identifiant du colis.
+     * \param[in] p_poids Le poids du colis en kg.
+     *
+     * \pre p_id > 0
+     * \pre p_poids > 0.0
+     *
+     * \return false si aucun fragment n'a pu recevoir le colis.
+     */
+bool GestionnaireFragmente::soumettreColis(int p_id, double p_poids)
+{
+    PRECONDITION(p_id > 0);
+    PRECONDITION(p_poids > 0.0);
+    const size_t nbFragments = m_fragments.size();
+    const size_t premier = static_cast<size_t>(p_id) % nbFragments;
+    if (p_poids > m_chargeMaxFlotte)
+        return m_fragments[premier]->gestionnaire->soumettreColis(p_id, p_poids);
+
+    for (size_t k = 0; k < nbFragments; ++k)
+    {
+        GestionnaireConcurrent& fragment = *m_fragments[(premier + k) % nbFragments]->gestionnaire;
+        if (p_poids <= fragment.reqChargeMaxFlotte() && fragment.soumettreColis(p_id, p_poids))
+            return true;
+    }
+    return false;
+}
+
+    /**
+     * \brief Lance un fil de planification par fragment.
+     *
+     * Chaque fil appelle planifierFragment en boucle; sans travail, il cède
+     * la main quelques passes puis dort brièvement entre deux passes.
+     *
+     * \pre Les fils ne sont pas déjà lancés.
+     */
+void GestionnaireFragmente::demarrer()
+{
+    PRECONDITION(!m_actif.load());
+    m_actif.store(true, memory_order_release);
+    for (size_t f = 0; f < m_fragments.size(); ++f)
+        m_fragments[f]->fil = thread(&GestionnaireFragmente::planifierEnBoucle, this, f);
+}
+
+    /**
+     * \brief Arrête les fils de planification; sans effet s'ils ne sont pas lancés.
+     */
+void GestionnaireFragmente::arreter()
+{
+    m_actif.store(false, memory_order_release);
+    for (unique_ptr<Fragment>& fragment : m_fragments)
+        if (fragment->fil.joinable())
+            fragment->fil.join();
+}
+
+    /**
+     * \brief Fait une passe de planification d'un fragment.
+     *
+     * Le fragment affecte d'abord ses propres colis; si sa file est vide et
+     * qu'il lui reste des drones libres, il vole ensuite chez les autres.
+     * Peut être appelé de plusieurs fils, y compris pendant que les fils de
+     * planification tournent.
+     *
+     * \param[in] p_fragment Le fragment.
+     * \param[in] p_nbMax Le nombre maximal de colis affectés.
+     * \return Le nombre de missions lancées.
+     *
+     * \pre p_fragment < reqNbFragments()
+     */
+size_t GestionnaireFragmente::planifierFragment(size_t p_fragment, size_t p_nbMax)
+{
+    PRECONDITION(p_fragment < m_fragments.size());
+    GestionnaireConcurrent& fragment = *m_fragments[p_fragment]->gestionnaire;
+    size_t nbAffectes = fragment.planifierMissions(p_nbMax);
+    if (nbAffectes < p_nbMax && fragment.reqNbColisEnAttente() == 0 && fragment.reqNbDronesLibres() > 0)
+        nbAffectes += voler(p_fragment, p_nbMax - nbAffectes);
+    return nbAffectes;
+}
+
+    /**
+     * \brief Termine la mission en cours d'un drone, dans le fragment du drone.
+     *
+     * \param[in] p_droneId L'identifiant du drone.
+     * \return false si le drone est inconnu, n'a pas de mission en cours, ou
+     *         si un autre fil termine déjà cette mission.
+     */
+bool GestionnaireFragmente::terminerMission(int p_droneId)
+{
+    MissionId missionId;
+    return terminerMission(p_droneId, missionId);
+}
+
+    /**
+     * \brief Termine la mission en cours d'un drone et en donne l'identifiant.
+     *
+     * \param[in] p_droneId L'identifiant du drone.
+     * \param[out] p_missionId L'identifiant de la mission terminée, inchangé sinon.
+     * \return false si le drone est inconnu, n'a pas de mission en cours, ou
+     *         si un autre fil termine déjà cette mission.
+     */
+bool GestionnaireFragmente::terminerMission(int p_droneId, MissionId& p_missionId)
+{
+    const size_t rang = m_indexDrones.trouver(p_droneId);
+    if (rang == IndexIdentifiants::AUCUN)
+        return false;
+    return m_fragments[m_fragmentParDrone[rang]]->gestionnaire->terminerMission(p_droneId, p_missionId);
+}
+
+    /**
+     * \brief Retourne la somme des compteurs des fragments, relevés au même instant.
+     *
+     * Le relevé lit d'abord sans rien suspendre et recommence si un
+     * déplacement de colis ou de drone a eu lieu pendant sa lecture; après
+     * ESSAIS_SANS_GEL essais, il gèle les déplacements (voir GelOperations).
+     * Chaque colis reçu avant le relevé est alors en attente, différé,
+     * refusé, en mission ou livré, dans un seul fragment, même pendant les
+     * vols de travail; un colis reçu pendant le relevé peut y être ou non.
+     * nbDrones == dronesDisponibles + dronesEnMission tient toujours.
+     */
+StatistiquesFlotte GestionnaireFragmente::reqCompteurs() const
+{
+    lock_guard<mutex> verrou(m_verrouReleve);
+    StatistiquesFlotte total;
+    for (size_t essai = 0; essai < ESSAIS_SANS_GEL; ++essai)
+    {
+        if (releverSansGel(total))
+            return total;
+        this_thread::yield();
+    }
+
+    m_gel.poser();
+    for (size_t f = 0; f < m_fragments.size(); ++f)
+        while (!m_fragments[f]->gestionnaire->reqOperations().estAuRepos(m_operationsReleve[f]))
+            this_thread::yield();
+    total = sommerCompteurs();
+    m_gel.lever();
+    return total;
+}
+
+size_t GestionnaireFragmente::reqNbColisVoles() const
+{
+    size_t total = 0;
+    for (const unique_ptr<Fragment>& fragment : m_fragments)
+        total += fragment->nbColisVoles.load(memory_order_relaxed);
+    return total;
+}
+
+size_t GestionnaireFragmente::reqNbFragments() const
+{
+    return m_fragments.size();
+}
+
+    /**
+     * \pre p_fragment < reqNbFragments()
+     */
+const GestionnaireConcurrent& GestionnaireFragmente::reqFragment(size_t p_fragment) const
+{
+    PRECONDITION(p_fragment < m_fragments.size());
+    return *m_fragments[p_fragment]->gestionnaire;
+}
+
+    /**
+     * \brief Lit les compteurs sans gel.
+     *
+     * \param[out] p_total La somme des compteurs, valable seulement si la lecture réussit.
+     * \return false si un fragment avait un déplacement en cours ou en a commencé un pendant la lecture.
+     */
+bool GestionnaireFragmente::releverSansGel(StatistiquesFlotte& p_total) const
+{
+    for (size_t f = 0; f < m_fragments.size(); ++f)
+        if (!m_fragments[f]->gestionnaire->reqOperations().estAuRepos(m_operationsReleve[f]))
+            return false;
+    p_total = sommerCompteurs();
+    atomic_thread_fence(memory_order_acquire);
+    for (size_t f = 0; f < m_fragments.size(); ++f)
+        if (m_fragments[f]->gestionnaire->reqOperations().commencees.load(memory_order_relaxed)
+            != m_operationsReleve[f])
+            return false;
+    return true;
+}
+
+StatistiquesFlotte GestionnaireFragmente::sommerCompteurs() const
+{
+    StatistiquesFlotte total;
+    for (const unique_ptr<Fragment>& fragment : m_fragments)
+    {
+        const StatistiquesFlotte compteurs = fragment->gestionnaire->reqCompteurs();
+        total.nbDrones += compteurs.nbDrones;
+        total.dronesDisponibles += compteurs.dronesDisponibles;
+        total.dronesEnMission += compteurs.dronesEnMission;
+        total.missionsPlanifiees += compteurs.missionsPlanifiees;
+        total.missionsEnCours += compteurs.missionsEnCours;
+        total.missionsTerminees += compteurs.missionsTerminees;
+        total.colisEnAttente += compteurs.colisEnAttente;
+        total.colisDifferes += compteurs.colisDifferes;
+        total.colisRefuses += compteurs.colisRefuses;
+        total.colisHorsPortee += compteurs.colisHorsPortee;
+    }
+    return total;
+}
+
+void GestionnaireFragmente::planifierEnBoucle(size_t p_fragment)
+{
+    size_t nbPassesVides = 0;
+    while (m_actif.load(memory_order_acquire))
+    {
+        if (planifierFragment(p_fragment, TAILLE_LOT) > 0)
+        {
+            nbPassesVides = 0;
+            continue;
+        }
+        if (++nbPassesVides < PASSES_AVANT_SOMMEIL)
+            this_thread::yield();
+        else
+            this_thread::sleep_for(chrono::microseconds(50));
+    }
+}
+
+    /**
+     * \brief Vole la moitié des colis en attente du premier autre fragment qui en a.
+     *
+     * Les victimes sont visitées à partir du fragment suivant, pour que des
+     * voleurs différents ne visent pas tous la même.
+     *
+     * \return Le nombre de colis volés et lancés.
+     */
+size_t GestionnaireFragmente::voler(size_t p_fragment, size_t p_nbMax)
+{
+    TRACER_PORTEE("voler");
+    Fragment& voleur = *m_fragments[p_fragment];
+    const size_t nbFragments = m_fragments.size();
+    for (size_t k = 1; k < nbFragments; ++k)
+    {
+        GestionnaireConcurrent& victime = *m_fragments[(p_fragment + k) % nbFragments]->gestionnaire;
+        const size_t enAttente = victime.reqNbColisEnAttente();
+        if (enAttente == 0)
+            continue;
+        const size_t nbVoles = voleur.gestionnaire->volerColis(victime, min(p_nbMax, (enAttente + 1) / 2));
+        if (nbVoles > 0)
+        {
+            voleur.nbColisVoles.fetch_add(nbVoles, memory_order_relaxed);
+            return nbVoles;
+        }
+    }
+    return 0;
+}
+
+} // namespace microdrone
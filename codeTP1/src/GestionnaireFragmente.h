@@ -0,0 +1,151 @@
+/**
+ * \file GestionnaireFragmente.h
+ * \brief Déclaration du gestionnaire dont la flotte et les colis sont répartis en fragments.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef GESTIONNAIREFRAGMENTE_H_DEJA_INCLU
+#define GESTIONNAIREFRAGMENTE_H_DEJA_INCLU
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "DroneAtomique.h"
+#include "GelOperations.h"
+#include "Gestionnaire.h"
+#include "GestionnaireConcurrent.h"
+#include "IndexIdentifiants.h"
+
+namespace microdrone
+{
+
+/**
+ * \class GestionnaireFragmente
+ * \brief Gestionnaire dont la flotte et les colis en attente sont répartis en
+ *        fragments indépendants, chacun planifié par son propre fil.
+ *
+ * Chaque fragment est un GestionnaireConcurrent : il a ses drones, sa file
+ * de colis et ses compteurs, sur des lignes de cache qui lui sont propres.
+ * Les drones sont distribués à tour de rôle par charge utile, pour que chaque
+ * fragment ait à peu près le même éventail de capacités. Un colis va au
+ * fragment id % nbFragments, ou au suivant qui peut le porter.
+ *
+ * Le fil d'un fragment applique planifierMissions à ses colis; quand sa file
+ * est vide et qu'il lui reste des drones libres, il vole la moitié des colis
+ * en attente du premier autre fragment qui en a (vol de travail). Les
+ * missions d'un fragment f sont numérotées f + 1, f + 1 + nbFragments, etc. :
+ * les identifiants restent uniques sur toute la flotte, sans compteur partagé.
+ *
+ * reqCompteurs relit les fragments tant qu'un déplacement de colis ou de
+ * drone a lieu pendant sa lecture, et les gèle au besoin (voir
+ * GelOperations) : un colis en cours de vol n'y est jamais dans aucune file.
+ */
+class GestionnaireFragmente
+{
+public:
+    static const std::size_t CAPACITE_DEFAUT;   //!< Colis en attente par fragment, au plus.
+
+    /**
+     * \brief Construit un gestionnaire sans drone, en p_nbFragments fragments.
+     */
+    explicit GestionnaireFragmente(std::size_t p_nbFragments, std::size_t p_capaciteColis = CAPACITE_DEFAUT);
+
+    /**
+     * \brief Arrête les fils de planification.
+     */
+    ~GestionnaireFragmente();
+
+    GestionnaireFragmente(const GestionnaireFragmente&) = delete;
+    GestionnaireFragmente& operator=(const GestionnaireFragmente&) = delete;
+
+    /**
+     * \brief Charge la flotte et les colis d'un scénario, fils arrêtés.
+     */
+    void chargerScenario(const std::string& p_nomFichier);
+
+    /**
+     * \brief Répartit une nouvelle flotte entre les fragments et vide les files, fils arrêtés.
+     */
+    void chargerFlotte(std::vector<DroneAtomique> p_drones);
+
+    /**
+     * \brief Reçoit un colis; peut être appelé de plusieurs fils en même temps.
+     */
+    bool soumettreColis(int p_id, double p_poids);
+
+    /**
+     * \brief Lance un fil de planification par fragment.
+     */
+    void demarrer();
+
+    /**
+     * \brief Arrête les fils de planification et attend leur fin.
+     */
+    void arreter();
+
+    /**
+     * \brief Fait une passe de planification d'un fragment, vol compris, dans le fil appelant.
+     */
+    std::size_t planifierFragment(std::size_t p_fragment,
+                                  std::size_t p_nbMax = std::numeric_limits<std::size_t>::max());
+
+    /**
+     * \brief Termine la mission en cours d'un drone; peut être appelé de plusieurs fils.
+     */
+    bool terminerMission(int p_droneId);
+
+    /**
+     * \brief Termine la mission en cours d'un drone et en donne l'identifiant.
+     */
+    bool terminerMission(int p_droneId, MissionId& p_missionId);
+
+    /**
+     * \brief Retourne la somme des compteurs des fragments, relevés au même instant.
+     */
+    StatistiquesFlotte reqCompteurs() const;
+
+    /**
+     * \brief Retourne le nombre de colis lancés par un autre fragment que le leur.
+     */
+    std::size_t reqNbColisVoles() const;
+
+    std::size_t reqNbFragments() const;
+
+    /**
+     * \brief Retourne un fragment, pour en lire les compteurs.
+     */
+    const GestionnaireConcurrent& reqFragment(std::size_t p_fragment) const;
+
+private:
+    struct alignas(64) Fragment
+    {
+        std::unique_ptr<GestionnaireConcurrent> gestionnaire;
+        std::atomic<std::size_t> nbColisVoles{0};   //!< Colis volés par ce fragment.
+        std::thread fil;                            //!< Fil de planification, s'il est lancé.
+    };
+
+    void planifierEnBoucle(std::size_t p_fragment);
+    bool releverSansGel(StatistiquesFlotte& p_total) const;
+    StatistiquesFlotte sommerCompteurs() const;
+    std::size_t voler(std::size_t p_fragment, std::size_t p_nbMax);
+
+    std::vector<std::unique_ptr<Fragment>> m_fragments;
+    std::vector<std::uint32_t> m_fragmentParDrone;  //!< Fragment de chaque drone, par rang dans m_indexDrones.
+    IndexIdentifiants m_indexDrones;                //!< Identifiant de drone → rang.
+    double m_chargeMaxFlotte;                       //!< Plus grande charge utile, tous fragments.
+    std::size_t m_capaciteColis;                    //!< Capacité de la file de chaque fragment.
+    std::atomic<bool> m_actif;                      //!< Vrai tant que les fils doivent planifier.
+    mutable GelOperations m_gel;                    //!< Posé pendant un relevé des compteurs.
+    mutable std::mutex m_verrouReleve;              //!< Un seul relevé à la fois.
+    mutable std::vector<std::uint64_t> m_operationsReleve;  //!< Opérations commencées par fragment, au relevé en cours.
+};
+
+} // namespace microdrone
+
+#endif // GESTIONNAIREFRAGMENTE_H_DEJA_INCLU
@@ -0,0 +1,122 @@
+/**
+ * \file HistogrammeLatences.cpp
+ * \brief Implantation de l'histogramme de latences à cases logarithmiques.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "HistogrammeLatences.h"
+#include <algorithm>
+#include <cmath>
+#include "ContratException.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+HistogrammeLatences::HistogrammeLatences()
+{
+    vider();
+}
+
+HistogrammeLatences::HistogrammeLatences(const HistogrammeLatences& p_autre)
+{
+    *this = p_autre;
+}
+
+HistogrammeLatences& HistogrammeLatences::operator=(const HistogrammeLatences& p_autre)
+{
+    for (size_t i = 0; i < NB_CASES; ++i)
+        m_cases[i].store(p_autre.m_cases[i].load(memory_order_relaxed), memory_order_relaxed);
+    m_max.store(p_autre.m_max.load(memory_order_relaxed), memory_order_relaxed);
+    return *this;
+}
+
+void HistogrammeLatences::vider()
+{
+    for (atomic<uint64_t>& compte : m_cases)
+        compte.store(0, memory_order_relaxed);
+    m_max.store(0, memory_order_relaxed);
+}
+
+uint64_t HistogrammeLatences::reqNbValeurs() const
+{
+    uint64_t nb = 0;
+    for (const atomic<uint64_t>& compte : m_cases)
+        nb += compte.load(memory_order_relaxed);
+    return nb;
+}
+
+double HistogrammeLatences::reqMoyenne() const
+{
+    uint64_t nb = 0;
+    double somme = 0.0;
+    for (size_t i = 0; i < NB_CASES; ++i)
+    {
+        const uint64_t compte = m_cases[i].load(memory_order_relaxed);
+        nb += compte;
+        somme += static_cast<double>(compte) * static_cast<double>(milieu(i));
+    }
+    return nb > 0 ? somme / static_cast<double>(nb) : 0.0;
+}
+
+uint64_t HistogrammeLatences::reqMax() const
+{
+    return m_max.load(memory_order_relaxed);
+}
+
+    /**
+     * \brief Retourne le quantile demandé, au milieu de la case qui le contient.
+     *
+     * \param[in] p_quantile La fraction des valeurs, par exemple 0.999 pour p99.9.
+     * \return La durée en nanosecondes (0 si l'histogramme est vide), à au
+     *         plus 1/64 près en relatif, sans dépasser reqMax().
+     *
+     * \pre 0.0 <= p_quantile <= 1.0
+     */
+uint64_t HistogrammeLatences::reqQuantile(double p_quantile) const
+{
+    PRECONDITION(p_quantile >= 0.0 && p_quantile <= 1.0);
+    uint64_t nb = 0;
+    array<uint64_t, NB_CASES> comptes;
+    for (size_t i = 0; i < NB_CASES; ++i)
+    {
+        comptes[i] = m_cases[i].load(memory_order_relaxed);
+        nb += comptes[i];
+    }
+    if (nb == 0)
+        return 0;
+
+    const uint64_t rang = max<uint64_t>(1, static_cast<uint64_t>(ceil(p_quantile * static_cast<double>(nb))));
+    uint64_t cumul = 0;
+    for (size_t i = 0; i < NB_CASES; ++i)
+    {
+        cumul += comptes[i];
+        if (cumul >= rang)
+            return min(milieu(i), reqMax());
+    }
+    return reqMax();
+}
+
+uint64_t HistogrammeLatences::borneInferieure(size_t p_case)
+{
+    if (p_case < CASES_PAR_OCTAVE)
+        return p_case;
+    const size_t decalage = p_case / CASES_PAR_OCTAVE - 1;
+    return (CASES_PAR_OCTAVE + p_case % CASES_PAR_OCTAVE) << decalage;
+}
+
+uint64_t HistogrammeLatences::largeur(size_t p_case)
+{
+    if (p_case < CASES_PAR_OCTAVE)
+        return 1;
+    return uint64_t(1) << (p_case / CASES_PAR_OCTAVE - 1);
+}
+
+uint64_t HistogrammeLatences::milieu(size_t p_case)
+{
+    return borneInferieure(p_case) + largeur(p_case) / 2;
+}
+
+} // namespace microdrone
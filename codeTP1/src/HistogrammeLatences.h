@@ -0,0 +1,110 @@
+/**
+ * \file HistogrammeLatences.h
+ * \brief Déclaration de l'histogramme de latences à cases logarithmiques.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef HISTOGRAMMELATENCES_H_DEJA_INCLU
+#define HISTOGRAMMELATENCES_H_DEJA_INCLU
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace microdrone
+{
+
+/**
+ * \class HistogrammeLatences
+ * \brief Compte des durées en nanosecondes dans des cases de largeur relative bornée.
+ *
+ * Comme dans un histogramme HDR, chaque puissance de deux est partagée en
+ * 2^BITS_PRECISION cases égales : une durée est connue à 1/32 près
+ * (environ 3 %), de la nanoseconde à plusieurs siècles, dans un tableau fixe
+ * d'environ 15 ko. Enregistrer une durée coûte un calcul d'indice et un
+ * seul incrément atomique relâché, sans verrou (le maximum n'est réécrit que
+ * lorsqu'il est dépassé); plusieurs fils peuvent enregistrer en même temps.
+ * Le nombre de valeurs, la moyenne et les quantiles sont déduits des cases
+ * à la lecture, qui est un instantané approximatif si des enregistrements
+ * ont lieu pendant qu'elle se fait.
+ */
+class HistogrammeLatences
+{
+public:
+    HistogrammeLatences();
+
+    /**
+     * \brief Copie un instantané des compteurs.
+     */
+    HistogrammeLatences(const HistogrammeLatences& p_autre);
+    HistogrammeLatences& operator=(const HistogrammeLatences& p_autre);
+
+    /**
+     * \brief Compte une durée.
+     */
+    void enregistrer(std::uint64_t p_nanosecondes)
+    {
+        m_cases[indiceCase(p_nanosecondes)].fetch_add(1, std::memory_order_relaxed);
+        std::uint64_t max = m_max.load(std::memory_order_relaxed);
+        while (p_nanosecondes > max
+               && !m_max.compare_exchange_weak(max, p_nanosecondes, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * \brief Remet tous les compteurs à zéro.
+     */
+    void vider();
+
+    /**
+     * \brief Retourne le nombre de durées enregistrées.
+     */
+    std::uint64_t reqNbValeurs() const;
+
+    /**
+     * \brief Retourne la durée moyenne, en nanosecondes, calculée sur les milieux des cases.
+     */
+    double reqMoyenne() const;
+
+    /**
+     * \brief Retourne la plus grande durée enregistrée, en nanosecondes.
+     */
+    std::uint64_t reqMax() const;
+
+    /**
+     * \brief Retourne la durée sous laquelle tombe la fraction p_quantile des valeurs.
+     */
+    std::uint64_t reqQuantile(double p_quantile) const;
+
+private:
+    static const unsigned int BITS_PRECISION = 5;
+    static const std::size_t CASES_PAR_OCTAVE = std::size_t(1) << BITS_PRECISION;
+    static const std::size_t NB_CASES = (64 - BITS_PRECISION + 1) * CASES_PAR_OCTAVE;
+
+    /**
+     * \brief Retourne la case d'une durée : directe sous 2^BITS_PRECISION,
+     *        puis CASES_PAR_OCTAVE cases par puissance de deux.
+     */
+    static std::size_t indiceCase(std::uint64_t p_valeur)
+    {
+        if (p_valeur < CASES_PAR_OCTAVE)
+            return static_cast<std::size_t>(p_valeur);
+        const unsigned int exposant = 63u - static_cast<unsigned int>(__builtin_clzll(p_valeur));
+        const unsigned int decalage = exposant - BITS_PRECISION;
+        return (decalage + 1) * CASES_PAR_OCTAVE + static_cast<std::size_t>((p_valeur >> decalage) - CASES_PAR_OCTAVE);
+    }
+
+    static std::uint64_t borneInferieure(std::size_t p_case);
+    static std::uint64_t largeur(std::size_t p_case);
+    static std::uint64_t milieu(std::size_t p_case);
+
+    std::array<std::atomic<std::uint64_t>, NB_CASES> m_cases;  //!< Compte par case.
+    std::atomic<std::uint64_t> m_max;                           //!< Plus grande durée.
+};
+
+} // namespace microdrone
+
+#endif // HISTOGRAMMELATENCES_H_DEJA_INCLU
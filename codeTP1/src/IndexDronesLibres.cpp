@@ -0,0 +1,195 @@
+/**
+ * \file IndexDronesLibres.cpp
+ * \brief Implantation de l'index des drones libres par charge utile.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "IndexDronesLibres.h"
+#include <algorithm>
+#include <limits>
+#include "ContratException.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+namespace
+{
+// Valeur des feuilles occupées : aucun poids positif ne la satisfait.
+const double OCCUPE = -1.0;
+}
+
+const size_t IndexDronesLibres::AUCUN = static_cast<size_t>(-1);
+
+    /**
+     * \brief Reconstruit l'index; tous les drones sont considérés libres.
+     *
+     * \param[in] p_chargesMax Charge utile de chaque drone, par rang dans la flotte.
+     * \param[in] p_portees Distance aller que chaque drone peut couvrir, en km.
+     *
+     * \pre p_portees.size() == p_chargesMax.size()
+     */
+void IndexDronesLibres::reinitialiser(const vector<double>& p_chargesMax, const vector<double>& p_portees)
+{
+    PRECONDITION(p_portees.size() == p_chargesMax.size());
+    m_chargesMax = p_chargesMax;
+    m_portees = p_portees;
+    m_parCharge.clear();
+    m_nbFeuilles = 1;
+    while (m_nbFeuilles < m_chargesMax.size())
+        m_nbFeuilles *= 2;
+    m_arbreMax.assign(2 * m_nbFeuilles, OCCUPE);
+
+    for (size_t rang = 0; rang < m_chargesMax.size(); ++rang)
+    {
+        m_parCharge.emplace(m_chargesMax[rang], m_portees[rang], rang);
+        m_arbreMax[m_nbFeuilles + rang] = m_chargesMax[rang];
+    }
+    for (size_t noeud = m_nbFeuilles - 1; noeud > 0; --noeud)
+        m_arbreMax[noeud] = max(m_arbreMax[2 * noeud], m_arbreMax[2 * noeud + 1]);
+}
+
+    /**
+     * \brief Retire un drone des drones libres (départ en mission).
+     *
+     * \param[in] p_rang Le rang du drone dans la flotte.
+     *
+     * \pre p_rang < taille de la flotte
+     */
+void IndexDronesLibres::retirer(size_t p_rang)
+{
+    PRECONDITION(p_rang < m_chargesMax.size());
+    m_parCharge.erase(Cle(m_chargesMax[p_rang], m_portees[p_rang], p_rang));
+    majArbre(p_rang, OCCUPE);
+}
+
+    /**
+     * \brief Remet un drone parmi les drones libres (retour de mission).
+     *
+     * \param[in] p_rang Le rang du drone dans la flotte.
+     *
+     * \pre p_rang < taille de la flotte
+     */
+void IndexDronesLibres::ajouter(size_t p_rang)
+{
+    PRECONDITION(p_rang < m_chargesMax.size());
+    m_parCharge.emplace(m_chargesMax[p_rang], m_portees[p_rang], p_rang);
+    majArbre(p_rang, m_chargesMax[p_rang]);
+}
+
+    /**
+     * \brief Cherche le drone libre dont la charge utile est la plus petite
+     *        parmi celles qui suffisent; à égalité, celui de plus courte
+     *        portée, puis le premier dans la flotte.
+     *
+     * \param[in] p_poids Le poids à transporter.
+     * \return Le rang du drone, ou AUCUN.
+     */
+size_t IndexDronesLibres::trouverMeilleurAjustement(double p_poids) const
+{
+    auto it = m_parCharge.lower_bound(Cle(p_poids, -numeric_limits<double>::infinity(), 0));
+    return it == m_parCharge.end() ? AUCUN : get<2>(*it);
+}
+
+    /**
+     * \brief Cherche, parmi les drones libres qui atteignent p_distance, celui
+     *        dont la charge utile est la plus petite parmi celles qui suffisent.
+     *
+     * Les drones d'une même charge utile sont triés par portée : une recherche
+     * par charge utile distincte suffit.
+     *
+     * \param[in] p_poids Le poids à transporter.
+     * \param[in] p_distance La distance aller à couvrir, en km.
+     * \return Le rang du drone, ou AUCUN.
+     */
+size_t IndexDronesLibres::trouverAPortee(double p_poids, double p_distance) const
+{
+    auto it = m_parCharge.lower_bound(Cle(p_poids, -numeric_limits<double>::infinity(), 0));
+    while (it != m_parCharge.end())
+    {
+        const double charge = get<0>(*it);
+        // Premier drone de cette charge qui atteint la distance, sinon début de la charge suivante.
+        it = m_parCharge.lower_bound(Cle(charge, p_distance, 0));
+        if (it != m_parCharge.end() && get<0>(*it) == charge)
+            return get<2>(*it);
+    }
+    return AUCUN;
+}
+
+    /**
+     * \brief Cherche le premier drone libre de la flotte pouvant porter p_poids,
+     *        comme le faisait le parcours linéaire de planifierMissions.
+     *
+     * \param[in] p_poids Le poids à transporter.
+     * \return Le rang du drone, ou AUCUN.
+     */
+size_t IndexDronesLibres::trouverPremierAjustement(double p_poids) const
+{
+    if (m_arbreMax.empty() || m_arbreMax[1] < p_poids)
+        return AUCUN;
+    size_t noeud = 1;
+    while (noeud < m_nbFeuilles)
+        noeud = m_arbreMax[2 * noeud] >= p_poids ? 2 * noeud : 2 * noeud + 1;
+    return noeud - m_nbFeuilles;
+}
+
+    /**
+     * \brief Cherche un drone libre selon la stratégie d'affectation.
+     *
+     * \param[in] p_poids Le poids à transporter.
+     * \param[in] p_strategie La règle de choix.
+     * \return Le rang du drone, ou AUCUN.
+     */
+size_t IndexDronesLibres::trouver(double p_poids, StrategieAffectation p_strategie) const
+{
+    return p_strategie == StrategieAffectation::MEILLEUR_AJUSTEMENT
+           ? trouverMeilleurAjustement(p_poids)
+           : trouverPremierAjustement(p_poids);
+}
+
+    /**
+     * \brief Liste des drones libres candidats pour un lot de p_parCharge colis.
+     *
+     * Deux drones de même charge utile sont interchangeables pour le coût
+     * d'affectation : au plus p_parCharge d'entre eux (par portée croissante,
+     * puis dans l'ordre de la flotte) sont retenus, et les suivants sont sautés
+     * en O(log n).
+     *
+     * \param[in] p_parCharge Nombre maximal de drones retenus par charge utile.
+     * \param[out] p_rangs Reçoit les rangs, par charge utile croissante.
+     */
+void IndexDronesLibres::listerCandidats(size_t p_parCharge, vector<size_t>& p_rangs) const
+{
+    p_rangs.clear();
+    auto it = m_parCharge.begin();
+    while (it != m_parCharge.end())
+    {
+        const double charge = get<0>(*it);
+        for (size_t nb = 0; nb < p_parCharge && it != m_parCharge.end() && get<0>(*it) == charge; ++nb, ++it)
+            p_rangs.push_back(get<2>(*it));
+        it = m_parCharge.upper_bound(Cle(charge, numeric_limits<double>::infinity(), AUCUN));
+    }
+}
+
+    /**
+     * \brief Retourne le nombre de drones libres indexés.
+     */
+size_t IndexDronesLibres::reqNbLibres() const
+{
+    return m_parCharge.size();
+}
+
+    /**
+     * \brief Met à jour une feuille de l'arbre et remonte jusqu'à la racine.
+     */
+void IndexDronesLibres::majArbre(size_t p_rang, double p_valeur)
+{
+    size_t noeud = m_nbFeuilles + p_rang;
+    m_arbreMax[noeud] = p_valeur;
+    for (noeud /= 2; noeud > 0; noeud /= 2)
+        m_arbreMax[noeud] = max(m_arbreMax[2 * noeud], m_arbreMax[2 * noeud + 1]);
+}
+
+} // namespace microdrone
@@ -0,0 +1,103 @@
+/**
+ * \file IndexDronesLibres.h
+ * \brief Déclaration de l'index des drones libres par charge utile.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef INDEXDRONESLIBRES_H_DEJA_INCLU
+#define INDEXDRONESLIBRES_H_DEJA_INCLU
+
+#include <cstddef>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace microdrone
+{
+
+//! Règle de choix du drone affecté à un colis.
+enum class StrategieAffectation
+{
+    PREMIER_AJUSTEMENT,   /*!< Premier drone libre de la flotte assez puissant */
+    MEILLEUR_AJUSTEMENT,  /*!< Drone libre de plus petite charge utile suffisante */
+    VECTORIELLE,          /*!< Premier ajustement par le noyau SIMD sur toute la flotte */
+    OPTIMALE              /*!< Couplage de coût minimal sur une fenêtre de colis */
+};
+
+/**
+ * \class IndexDronesLibres
+ * \brief Index des drones libres de la flotte, repérés par leur rang dans m_flotte.
+ *
+ * Deux structures sont tenues à jour à chaque départ et retour de drone :
+ * un ensemble ordonné par (charge utile, portée, rang) pour le meilleur
+ * ajustement, et un arbre de segments des charges libres maximales pour le
+ * premier ajustement. Les deux requêtes coûtent O(log n); le meilleur
+ * ajustement restreint aux drones qui atteignent une distance coûte
+ * O(log n) par charge utile distincte.
+ */
+class IndexDronesLibres
+{
+public:
+    static const std::size_t AUCUN; //!< Rang retourné quand aucun drone ne convient.
+
+    /**
+     * \brief Reconstruit l'index pour une flotte dont tous les drones sont libres.
+     */
+    void reinitialiser(const std::vector<double>& p_chargesMax, const std::vector<double>& p_portees);
+
+    /**
+     * \brief Marque un drone comme occupé.
+     */
+    void retirer(std::size_t p_rang);
+
+    /**
+     * \brief Marque un drone comme libre.
+     */
+    void ajouter(std::size_t p_rang);
+
+    /**
+     * \brief Retourne le drone libre de plus petite charge utile suffisante.
+     */
+    std::size_t trouverMeilleurAjustement(double p_poids) const;
+
+    /**
+     * \brief Retourne le premier drone libre, dans l'ordre de la flotte, assez puissant.
+     */
+    std::size_t trouverPremierAjustement(double p_poids) const;
+
+    /**
+     * \brief Retourne le drone libre de plus petite charge utile suffisante qui atteint p_distance.
+     */
+    std::size_t trouverAPortee(double p_poids, double p_distance) const;
+
+    /**
+     * \brief Retourne le drone choisi selon la stratégie demandée.
+     */
+    std::size_t trouver(double p_poids, StrategieAffectation p_strategie) const;
+
+    /**
+     * \brief Liste au plus p_parCharge drones libres de chaque charge utile.
+     */
+    void listerCandidats(std::size_t p_parCharge, std::vector<std::size_t>& p_rangs) const;
+
+    /**
+     * \brief Retourne le nombre de drones libres.
+     */
+    std::size_t reqNbLibres() const;
+
+private:
+    typedef std::tuple<double, double, std::size_t> Cle;     //!< (charge utile, portée, rang).
+
+    void majArbre(std::size_t p_rang, double p_valeur);
+
+    std::vector<double> m_chargesMax;                        //!< Charge utile par rang.
+    std::vector<double> m_portees;                           //!< Portée par rang, en km.
+    std::set<Cle> m_parCharge;                               //!< Drones libres triés par charge, puis portée.
+    std::vector<double> m_arbreMax;                          //!< Arbre de segments (charge libre max).
+    std::size_t m_nbFeuilles = 0;                            //!< Nombre de feuilles de l'arbre.
+};
+
+} // namespace microdrone
+
+#endif // INDEXDRONESLIBRES_H_DEJA_INCLU
@@ -0,0 +1,135 @@
+/**
+ * \file IndexIdentifiants.cpp
+ * \brief Implantation de l'index identifiant → rang.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "IndexIdentifiants.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+namespace
+{
+// Le tableau direct peut compter jusqu'à ce facteur de cases par identifiant
+// indexé (plus une marge fixe) avant de basculer vers la table de hachage.
+const size_t FACTEUR_DENSITE = 4;
+const size_t MARGE_DENSITE = 1024;
+}
+
+const size_t IndexIdentifiants::AUCUN = static_cast<size_t>(-1);
+
+    /**
+     * \brief Constructeur d'un index vide, en mode tableau.
+     */
+IndexIdentifiants::IndexIdentifiants():m_modeDirect(true), m_taille(0)
+{
+}
+
+    /**
+     * \brief Vide l'index.
+     *
+     * \post reqTaille() == 0
+     */
+void IndexIdentifiants::vider()
+{
+    m_modeDirect = true;
+    m_direct.clear();
+    m_hachage.clear();
+    m_taille = 0;
+}
+
+    /**
+     * \brief Réserve la place pour un nombre d'identifiants.
+     *
+     * \param[in] p_nb Le nombre d'identifiants attendus.
+     */
+void IndexIdentifiants::reserver(size_t p_nb)
+{
+    if (m_modeDirect)
+        m_direct.reserve(p_nb + 1);
+    else
+        m_hachage.reserve(p_nb);
+}
+
+    /**
+     * \brief Associe un identifiant à un rang, sauf s'il est déjà indexé.
+     *
+     * \param[in] p_id L'identifiant.
+     * \param[in] p_rang Le rang de l'élément dans son conteneur.
+     * \return true si l'identifiant a été ajouté, false s'il était déjà présent.
+     */
+bool IndexIdentifiants::ajouter(int p_id, size_t p_rang)
+{
+    if (m_modeDirect)
+    {
+        size_t limite = FACTEUR_DENSITE * (m_taille + 1) + MARGE_DENSITE;
+        if (p_id < 0 || static_cast<size_t>(p_id) >= limite)
+        {
+            passerAuHachage();
+        }
+        else
+        {
+            size_t id = static_cast<size_t>(p_id);
+            if (id >= m_direct.size())
+                m_direct.resize(id + 1, AUCUN);
+            if (m_direct[id] != AUCUN)
+                return false;
+            m_direct[id] = p_rang;
+            ++m_taille;
+            return true;
+        }
+    }
+
+    if (!m_hachage.emplace(p_id, p_rang).second)
+        return false;
+    ++m_taille;
+    return true;
+}
+
+    /**
+     * \brief Cherche le rang associé à un identifiant.
+     *
+     * \param[in] p_id L'identifiant recherché.
+     * \return Le rang, ou AUCUN si l'identifiant n'est pas indexé.
+     */
+size_t IndexIdentifiants::trouver(int p_id) const
+{
+    if (m_modeDirect)
+    {
+        if (p_id < 0 || static_cast<size_t>(p_id) >= m_direct.size())
+            return AUCUN;
+        return m_direct[static_cast<size_t>(p_id)];
+    }
+    auto it = m_hachage.find(p_id);
+    return it == m_hachage.end() ? AUCUN : it->second;
+}
+
+    /**
+     * \brief Retourne le nombre d'identifiants indexés.
+     */
+size_t IndexIdentifiants::reqTaille() const
+{
+    return m_taille;
+}
+
+    /**
+     * \brief Transfère le contenu du tableau direct dans la table de hachage.
+     */
+void IndexIdentifiants::passerAuHachage()
+{
+    m_hachage.reserve(m_taille * 2);
+    for (size_t id = 0; id < m_direct.size(); ++id)
+    {
+        if (m_direct[id] != AUCUN)
+            m_hachage.emplace(static_cast<int>(id), m_direct[id]);
+    }
+    m_direct.clear();
+    m_direct.shrink_to_fit();
+    m_modeDirect = false;
+}
+
+} // namespace microdrone
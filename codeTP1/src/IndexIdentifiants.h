@@ -0,0 +1,71 @@
+/**
+ * \file IndexIdentifiants.h
+ * \brief Déclaration de l'index identifiant → rang.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef INDEXIDENTIFIANTS_H_DEJA_INCLU
+#define INDEXIDENTIFIANTS_H_DEJA_INCLU
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace microdrone
+{
+
+/**
+ * \class IndexIdentifiants
+ * \brief Associe un identifiant (drone ou colis) à son rang dans un conteneur.
+ *
+ * Tant que les identifiants restent denses, l'index est un simple tableau
+ * indexé par l'identifiant; dès qu'un identifiant trop grand apparaît, il
+ * bascule vers une table de hachage. Dans les deux cas une recherche coûte
+ * O(1) quelle que soit la taille de la flotte. Si un identifiant est ajouté
+ * deux fois, le premier rang est conservé, comme le faisait la recherche linéaire.
+ */
+class IndexIdentifiants
+{
+public:
+    static const std::size_t AUCUN; //!< Rang retourné pour un identifiant inconnu.
+
+    IndexIdentifiants();
+
+    /**
+     * \brief Vide l'index et revient au mode tableau.
+     */
+    void vider();
+
+    /**
+     * \brief Réserve la place pour p_nb identifiants.
+     */
+    void reserver(std::size_t p_nb);
+
+    /**
+     * \brief Ajoute un identifiant s'il est absent.
+     */
+    bool ajouter(int p_id, std::size_t p_rang);
+
+    /**
+     * \brief Retourne le rang associé à un identifiant.
+     */
+    std::size_t trouver(int p_id) const;
+
+    /**
+     * \brief Retourne le nombre d'identifiants indexés.
+     */
+    std::size_t reqTaille() const;
+
+private:
+    void passerAuHachage();
+
+    bool m_modeDirect;                                   //!< Vrai tant que les identifiants sont denses.
+    std::vector<std::size_t> m_direct;                   //!< Rang par identifiant (mode tableau).
+    std::unordered_map<int, std::size_t> m_hachage;      //!< Rang par identifiant (mode hachage).
+    std::size_t m_taille;                                //!< Nombre d'identifiants indexés.
+};
+
+} // namespace microdrone
+
+#endif // INDEXIDENTIFIANTS_H_DEJA_INCLU
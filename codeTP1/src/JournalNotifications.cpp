@@ -0,0 +1,174 @@
+/**
+ * \file JournalNotifications.cpp
+ * \brief Implantation du journal circulaire des notifications système.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "JournalNotifications.h"
+#include <iomanip>
+#include <sstream>
+#include "ContratException.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+const size_t JournalNotifications::CAPACITE_DEFAUT = 4096;
+
+    /**
+     * \brief Compose le texte de la notification, tel qu'affiché par le gestionnaire.
+     *
+     * Pour une mission de plusieurs colis, seul le premier est nommé, suivi
+     * du nombre des autres.
+     *
+     * \return Le texte de la notification.
+     */
+string Notification::formater() const
+{
+    ostringstream oss;
+    switch (type)
+    {
+        case TypeNotification::REPLI_PREMIER_AJUSTEMENT:
+            oss << "Budget d'affectation dépassé, fenêtre planifiée au premier ajustement";
+            break;
+        case TypeNotification::AUCUN_DRONE:
+            oss << "Aucun drone disponible pour le colis #" << colisId;
+            break;
+        case TypeNotification::COLIS_DIFFERE:
+            oss << "Colis #" << colisId << " différé, aucun drone disponible";
+            break;
+        case TypeNotification::COLIS_TROP_LOURD:
+            oss << "Colis #" << colisId << " trop lourd (> " << fixed << setprecision(1) << poids << " kg)";
+            break;
+        case TypeNotification::COLIS_HORS_PORTEE:
+            oss << "Colis #" << colisId << " hors de portée (> " << fixed << setprecision(1) << poids << " km)";
+            break;
+        case TypeNotification::MISSION_PLANIFIEE:
+            oss << "Mission planifiée pour colis #" << colisId;
+            if (nbColis > 1)
+                oss << " (+" << nbColis - 1 << ")";
+            break;
+        case TypeNotification::AUCUNE_MISSION_A_LANCER:
+            oss << "Aucune mission planifiée à lancer.";
+            break;
+        case TypeNotification::MISSION_LANCEE:
+            oss << "Mission lancée : [Drone #" << droneId << " → Colis #" << colisId;
+            if (nbColis > 1)
+                oss << " (+" << nbColis - 1 << ")";
+            oss << "] État: EN COURS";
+            break;
+        case TypeNotification::AUCUNE_MISSION_EN_COURS:
+            if (droneId != 0)
+                oss << "Aucune mission en cours pour le drone D" << droneId;
+            else if (missionId != 0)
+                oss << "Aucune mission en cours d'ID " << missionId;
+            else
+                oss << "Aucune mission en cours à terminer";
+            break;
+        case TypeNotification::MISSION_TERMINEE:
+            oss << " Mission terminée par le drone D" << droneId;
+            break;
+    }
+    return oss.str();
+}
+
+    /**
+     * \brief Construit un journal vide dont toutes les cases sont réservées.
+     *
+     * \param[in] p_capacite Le nombre maximal de notifications conservées.
+     * \param[in] p_politique Le comportement du journal plein.
+     *
+     * \pre p_capacite > 0
+     */
+JournalNotifications::JournalNotifications(size_t p_capacite, PolitiqueDebordement p_politique)
+    :m_cases(p_capacite), m_debut(0), m_taille(0), m_politique(p_politique), m_nbPerdues(0)
+{
+    PRECONDITION(p_capacite > 0);
+}
+
+    /**
+     * \brief Ajoute une notification, en O(1) et sans allocation.
+     *
+     * Journal plein : ECRASER_ANCIENNES remplace la plus ancienne,
+     * REJETER_NOUVELLES abandonne p_notification. Dans les deux cas la perte
+     * est comptée.
+     *
+     * \param[in] p_notification La notification à conserver.
+     */
+void JournalNotifications::ajouter(const Notification& p_notification)
+{
+    if (m_taille == m_cases.size())
+    {
+        m_nbPerdues++;
+        if (m_politique == PolitiqueDebordement::REJETER_NOUVELLES)
+            return;
+        m_cases[m_debut] = p_notification;
+        m_debut = (m_debut + 1) % m_cases.size();
+        return;
+    }
+    m_cases[(m_debut + m_taille) % m_cases.size()] = p_notification;
+    m_taille++;
+}
+
+    /**
+     * \pre !estVide()
+     */
+const Notification& JournalNotifications::derniere() const
+{
+    PRECONDITION(!estVide());
+    return m_cases[(m_debut + m_taille - 1) % m_cases.size()];
+}
+
+    /**
+     * \pre !estVide()
+     */
+void JournalNotifications::retirerDerniere()
+{
+    PRECONDITION(!estVide());
+    m_taille--;
+}
+
+    /**
+     * \pre p_position < taille()
+     */
+const Notification& JournalNotifications::operator[](size_t p_position) const
+{
+    PRECONDITION(p_position < m_taille);
+    return m_cases[(m_debut + p_position) % m_cases.size()];
+}
+
+void JournalNotifications::vider()
+{
+    m_debut = 0;
+    m_taille = 0;
+    m_nbPerdues = 0;
+}
+
+size_t JournalNotifications::taille() const
+{
+    return m_taille;
+}
+
+bool JournalNotifications::estVide() const
+{
+    return m_taille == 0;
+}
+
+size_t JournalNotifications::capacite() const
+{
+    return m_cases.size();
+}
+
+PolitiqueDebordement JournalNotifications::reqPolitique() const
+{
+    return m_politique;
+}
+
+uint64_t JournalNotifications::reqNbPerdues() const
+{
+    return m_nbPerdues;
+}
+
+} // namespace microdrone
@@ -0,0 +1,145 @@
+/**
+ * \file JournalNotifications.h
+ * \brief Déclaration du journal circulaire des notifications système.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef JOURNALNOTIFICATIONS_H_DEJA_INCLU
+#define JOURNALNOTIFICATIONS_H_DEJA_INCLU
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Mission.h"
+
+namespace microdrone
+{
+
+//! Nature d'une notification système.
+enum class TypeNotification : std::uint8_t
+{
+    REPLI_PREMIER_AJUSTEMENT,   /*!< Budget du couplage OPTIMALE dépassé */
+    AUCUN_DRONE,                /*!< Aucun drone pour un colis, la planification s'arrête */
+    COLIS_DIFFERE,              /*!< Colis mis de côté faute de drone */
+    COLIS_TROP_LOURD,           /*!< Colis refusé; poids : la limite dépassée */
+    COLIS_HORS_PORTEE,          /*!< Colis refusé; poids : la portée dépassée, en km */
+    MISSION_PLANIFIEE,          /*!< Mission ajoutée à la file des missions planifiées */
+    AUCUNE_MISSION_A_LANCER,    /*!< lancerMission sans mission planifiée */
+    MISSION_LANCEE,             /*!< Mission passée à EN_COURS */
+    AUCUNE_MISSION_EN_COURS,    /*!< Fin de mission demandée sans mission en cours */
+    MISSION_TERMINEE            /*!< Mission passée à TERMINEE */
+};
+
+/**
+ * \brief Notification compacte; son texte n'est composé qu'à la lecture.
+ *
+ * Les champs sans objet pour le type valent 0.
+ */
+struct Notification
+{
+    std::chrono::steady_clock::time_point instant;  //!< Moment de l'émission.
+    MissionId missionId;                            //!< Mission concernée.
+    double poids;                                   //!< Poids en kg (limite pour COLIS_TROP_LOURD).
+    int droneId;                                    //!< Drone concerné.
+    int colisId;                                    //!< Colis concerné (premier du chargement).
+    std::uint8_t nbColis;                           //!< Colis de la mission.
+    TypeNotification type;                          //!< Nature de la notification.
+
+    /**
+     * \brief Compose le texte de la notification.
+     */
+    std::string formater() const;
+};
+
+//! Comportement du journal plein.
+enum class PolitiqueDebordement
+{
+    ECRASER_ANCIENNES,  /*!< La notification la plus ancienne est remplacée */
+    REJETER_NOUVELLES   /*!< La nouvelle notification est abandonnée */
+};
+
+/**
+ * \class JournalNotifications
+ * \brief Tampon circulaire de capacité fixe des notifications système.
+ *
+ * Toute la mémoire est réservée à la construction : ajouter une notification
+ * ne fait qu'une copie de quelques dizaines d'octets, et la taille du journal
+ * reste bornée quel que soit le nombre de notifications émises. Quand il est
+ * plein, la politique choisie décide laquelle est perdue; les pertes sont
+ * comptées. La lecture se fait par la fin, comme sur une pile.
+ */
+class JournalNotifications
+{
+public:
+    static const std::size_t CAPACITE_DEFAUT;   //!< Capacité d'un journal construit par défaut.
+
+    /**
+     * \brief Construit un journal vide.
+     */
+    explicit JournalNotifications(std::size_t p_capacite = CAPACITE_DEFAUT,
+                                  PolitiqueDebordement p_politique = PolitiqueDebordement::ECRASER_ANCIENNES);
+
+    /**
+     * \brief Ajoute une notification en appliquant la politique de débordement.
+     */
+    void ajouter(const Notification& p_notification);
+
+    /**
+     * \brief Retourne la notification la plus récente.
+     */
+    const Notification& derniere() const;
+
+    /**
+     * \brief Retire la notification la plus récente.
+     */
+    void retirerDerniere();
+
+    /**
+     * \brief Retourne la p_position-ième notification, de la plus ancienne à la plus récente.
+     */
+    const Notification& operator[](std::size_t p_position) const;
+
+    /**
+     * \brief Retire toutes les notifications et remet le compteur de pertes à zéro.
+     */
+    void vider();
+
+    /**
+     * \brief Retourne le nombre de notifications conservées.
+     */
+    std::size_t taille() const;
+
+    /**
+     * \brief Indique si le journal est vide.
+     */
+    bool estVide() const;
+
+    /**
+     * \brief Retourne le nombre maximal de notifications conservées.
+     */
+    std::size_t capacite() const;
+
+    /**
+     * \brief Retourne la politique de débordement.
+     */
+    PolitiqueDebordement reqPolitique() const;
+
+    /**
+     * \brief Retourne le nombre de notifications perdues par débordement.
+     */
+    std::uint64_t reqNbPerdues() const;
+
+private:
+    std::vector<Notification> m_cases;      //!< Tampon circulaire, de taille fixe.
+    std::size_t m_debut;                    //!< Case de la plus ancienne notification.
+    std::size_t m_taille;                   //!< Notifications conservées.
+    PolitiqueDebordement m_politique;       //!< Comportement du journal plein.
+    std::uint64_t m_nbPerdues;              //!< Notifications écrasées ou rejetées.
+};
+
+} // namespace microdrone
+
+#endif // JOURNALNOTIFICATIONS_H_DEJA_INCLU
@@ -0,0 +1,442 @@
+/**
+ * \file LecteurScenario.cpp
+ * \brief Implantation du lecteur de scénario projeté en mémoire.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "LecteurScenario.h"
+#include "ScenarioBinaire.h"
+#include "Traceur.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <stdexcept>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace microdrone
+{
+
+namespace
+{
+
+bool estEspace(char p_c)
+{
+    return p_c == ' ' || p_c == '\t' || p_c == '\r' || p_c == '\v' || p_c == '\f';
+}
+
+void sauterEspaces(const char*& p_curseur, const char* p_fin)
+{
+    while (p_curseur != p_fin && estEspace(*p_curseur))
+        ++p_curseur;
+}
+
+string_view lireMot(const char*& p_curseur, const char* p_fin)
+{
+    sauterEspaces(p_curseur, p_fin);
+    const char* debut = p_curseur;
+    while (p_curseur != p_fin && !estEspace(*p_curseur))
+        ++p_curseur;
+    return string_view(debut, static_cast<size_t>(p_curseur - debut));
+}
+
+// Comme operator>>, un '+' initial est accepté devant un nombre.
+void sauterSignePlus(const char*& p_curseur, const char* p_fin)
+{
+    if (p_curseur != p_fin && *p_curseur == '+' && p_curseur + 1 != p_fin
+        && *(p_curseur + 1) != '-' && *(p_curseur + 1) != '+')
+        ++p_curseur;
+}
+
+bool lireEntier(const char*& p_curseur, const char* p_fin, int& p_valeur)
+{
+    sauterEspaces(p_curseur, p_fin);
+    sauterSignePlus(p_curseur, p_fin);
+    from_chars_result res = from_chars(p_curseur, p_fin, p_valeur);
+    if (res.ec != errc())
+        return false;
+    p_curseur = res.ptr;
+    return true;
+}
+
+bool lireReel(const char*& p_curseur, const char* p_fin, double& p_valeur)
+{
+    sauterEspaces(p_curseur, p_fin);
+    sauterSignePlus(p_curseur, p_fin);
+    from_chars_result res = from_chars(p_curseur, p_fin, p_valeur);
+    if (res.ec != errc())
+        return false;
+    p_curseur = res.ptr;
+    return true;
+}
+
+// En deçà de cette taille, une tranche ne justifie pas un fil supplémentaire.
+const size_t TAILLE_MIN_TRANCHE = 1 << 16;
+
+[[noreturn]] void signalerLigneInvalide(size_t p_octet, const char* p_type)
+{
+    throw runtime_error("Scénario mal formé à l'octet " + to_string(p_octet)
+                        + " : enregistrement " + p_type + " invalide");
+}
+
+} // namespace
+
+    /**
+     * \brief Ouvre le fichier et le projette en mémoire en lecture seule.
+     *
+     * \param[in] p_nomFichier Le chemin du fichier à projeter.
+     *
+     * \throw runtime_error si le fichier ne peut pas être ouvert ou projeté.
+     */
+FichierProjete::FichierProjete(const string& p_nomFichier):m_donnees(nullptr), m_taille(0)
+{
+#ifdef _WIN32
+    m_fichier = nullptr;
+    m_projection = nullptr;
+    HANDLE fichier = CreateFileA(p_nomFichier.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fichier == INVALID_HANDLE_VALUE)
+        throw runtime_error("Impossible d'ouvrir le fichier " + p_nomFichier);
+    LARGE_INTEGER taille;
+    if (!GetFileSizeEx(fichier, &taille))
+    {
+        CloseHandle(fichier);
+        throw runtime_error("Impossible de lire la taille du fichier " + p_nomFichier);
+    }
+    m_fichier = fichier;
+    m_taille = static_cast<size_t>(taille.QuadPart);
+    if (m_taille == 0)
+        return;
+    HANDLE projection = CreateFileMappingA(fichier, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* vue = projection ? MapViewOfFile(projection, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (vue == nullptr)
+    {
+        if (projection)
+            CloseHandle(projection);
+        CloseHandle(fichier);
+        throw runtime_error("Impossible de projeter le fichier " + p_nomFichier);
+    }
+    m_projection = projection;
+    m_donnees = static_cast<const char*>(vue);
+#else
+    int descripteur = ::open(p_nomFichier.c_str(), O_RDONLY);
+    if (descripteur < 0)
+        throw runtime_error("Impossible d'ouvrir le fichier " + p_nomFichier);
+    struct stat info;
+    if (::fstat(descripteur, &info) != 0)
+    {
+        ::close(descripteur);
+        throw runtime_error("Impossible de lire la taille du fichier " + p_nomFichier);
+    }
+    m_taille = static_cast<size_t>(info.st_size);
+    if (m_taille > 0)
+    {
+        void* vue = ::mmap(nullptr, m_taille, PROT_READ, MAP_PRIVATE, descripteur, 0);
+        if (vue == MAP_FAILED)
+        {
+            ::close(descripteur);
+            throw runtime_error("Impossible de projeter le fichier " + p_nomFichier);
+        }
+        ::madvise(vue, m_taille, MADV_SEQUENTIAL);
+        m_donnees = static_cast<const char*>(vue);
+    }
+    // La projection reste valide après la fermeture du descripteur.
+    ::close(descripteur);
+#endif
+}
+
+    /**
+     * \brief Libère la projection du fichier.
+     */
+FichierProjete::~FichierProjete()
+{
+#ifdef _WIN32
+    if (m_donnees)
+        UnmapViewOfFile(m_donnees);
+    if (m_projection)
+        CloseHandle(m_projection);
+    if (m_fichier)
+        CloseHandle(m_fichier);
+#else
+    if (m_donnees)
+        ::munmap(const_cast<char*>(m_donnees), m_taille);
+#endif
+}
+
+    /**
+     * \brief Retourne le début du contenu projeté.
+     *
+     * \return Un pointeur sur le premier octet, ou nullptr si le fichier est vide.
+     */
+const char* FichierProjete::reqDonnees() const
+{
+    return m_donnees;
+}
+
+    /**
+     * \brief Retourne la taille du fichier projeté.
+     *
+     * \return Le nombre d'octets projetés.
+     */
+size_t FichierProjete::reqTaille() const
+{
+    return m_taille;
+}
+
+    /**
+     * \brief Constructeur du lecteur : projette le fichier sans l'analyser.
+     *
+     * \param[in] p_nomFichier Le nom du fichier de scénario.
+     *
+     * \throw runtime_error si le fichier ne peut pas être ouvert.
+     */
+LecteurScenario::LecteurScenario(const string& p_nomFichier):m_fichier(p_nomFichier)
+{
+}
+
+    /**
+     * \brief Analyse le fichier, séquentiellement ou par tranches parallèles.
+     *
+     * Un scénario binaire (voir ScenarioBinaire.h) est reconnu à sa signature
+     * et décodé directement; p_nbFils n'a alors pas d'effet.
+     *
+     * Avec p_nbFils > 1, le fichier est coupé en au plus p_nbFils tranches
+     * alignées sur les fins de ligne. Les enregistrements sont fusionnés dans
+     * l'ordre des tranches : le résultat est identique à l'analyse séquentielle.
+     *
+     * \param[in] p_nbFils Nombre de fils d'analyse (0 : selon le matériel).
+     *
+     * \throw runtime_error si une ligne DRONE ou COLIS est mal formée;
+     *        le message indique la position de la ligne en octets. Si plusieurs
+     *        tranches échouent, l'erreur la plus tôt dans le fichier est signalée.
+     *        Aussi si un scénario binaire est incohérent.
+     */
+void LecteurScenario::analyser(unsigned int p_nbFils)
+{
+    m_modeles.clear();
+    m_drones.clear();
+    m_colis.clear();
+
+    const char* debut = m_fichier.reqDonnees();
+    const char* fin = debut + m_fichier.reqTaille();
+    size_t taille = m_fichier.reqTaille();
+
+    if (estScenarioBinaire(debut, taille))
+    {
+        lireScenarioBinaire(debut, taille, m_modeles, m_drones, m_colis);
+        return;
+    }
+
+    if (p_nbFils == 0)
+        p_nbFils = max(1u, thread::hardware_concurrency());
+    size_t nbTranches = min<size_t>(p_nbFils, max<size_t>(1, taille / TAILLE_MIN_TRANCHE));
+    if (nbTranches <= 1)
+    {
+        analyserTranche(debut, fin, m_modeles, m_drones, m_colis);
+        return;
+    }
+
+    // Bornes des tranches, chacune commençant au début d'une ligne.
+    vector<const char*> bornes(1, debut);
+    for (size_t i = 1; i < nbTranches; ++i)
+    {
+        const char* coupure = max(bornes.back(), debut + taille * i / nbTranches);
+        const char* finLigne = static_cast<const char*>(memchr(coupure, '\n', static_cast<size_t>(fin - coupure)));
+        if (finLigne == nullptr)
+            break;
+        bornes.push_back(finLigne + 1);
+    }
+    bornes.push_back(fin);
+    nbTranches = bornes.size() - 1;
+
+    vector<vector<EnregistrementModele>> modeles(nbTranches);
+    vector<vector<EnregistrementDrone>> drones(nbTranches);
+    vector<vector<EnregistrementColis>> colis(nbTranches);
+    vector<exception_ptr> erreurs(nbTranches);
+    auto travail = [&](size_t p_tranche)
+    {
+        TRACER_PORTEE("analyserTranche");
+        try
+        {
+            analyserTranche(bornes[p_tranche], bornes[p_tranche + 1], modeles[p_tranche],
+                            drones[p_tranche], colis[p_tranche]);
+        }
+        catch (...)
+        {
+            erreurs[p_tranche] = current_exception();
+        }
+    };
+
+    vector<thread> fils;
+    fils.reserve(nbTranches - 1);
+    for (size_t i = 1; i < nbTranches; ++i)
+        fils.emplace_back(travail, i);
+    travail(0);
+    for (thread& f : fils)
+        f.join();
+
+    for (const exception_ptr& erreur : erreurs)
+    {
+        if (erreur)
+            rethrow_exception(erreur);
+    }
+
+    size_t nbDrones = 0;
+    size_t nbColis = 0;
+    for (size_t i = 0; i < nbTranches; ++i)
+    {
+        nbDrones += drones[i].size();
+        nbColis += colis[i].size();
+    }
+    m_drones.reserve(nbDrones);
+    m_colis.reserve(nbColis);
+    for (size_t i = 0; i < nbTranches; ++i)
+    {
+        m_modeles.insert(m_modeles.end(), modeles[i].begin(), modeles[i].end());
+        m_drones.insert(m_drones.end(), drones[i].begin(), drones[i].end());
+        m_colis.insert(m_colis.end(), colis[i].begin(), colis[i].end());
+    }
+}
+
+    /**
+     * \brief Découpe une tranche du fichier en lignes et les analyse sur place.
+     *
+     * \param[in] p_debut Début de la tranche (début d'une ligne).
+     * \param[in] p_fin Fin de la tranche (après un '\n' ou fin du fichier).
+     * \param[out] p_modeles Reçoit les modèles lus dans la tranche.
+     * \param[out] p_drones Reçoit les drones lus dans la tranche.
+     * \param[out] p_colis Reçoit les colis lus dans la tranche.
+     */
+void LecteurScenario::analyserTranche(const char* p_debut, const char* p_fin,
+                                      vector<EnregistrementModele>& p_modeles,
+                                      vector<EnregistrementDrone>& p_drones,
+                                      vector<EnregistrementColis>& p_colis) const
+{
+    const char* curseur = p_debut;
+    while (curseur < p_fin)
+    {
+        const char* finLigne = static_cast<const char*>(memchr(curseur, '\n', static_cast<size_t>(p_fin - curseur)));
+        if (finLigne == nullptr)
+            finLigne = p_fin;
+        analyserLigne(curseur, finLigne, p_modeles, p_drones, p_colis);
+        curseur = finLigne + 1;
+    }
+}
+
+    /**
+     * \brief Analyse une seule ligne du scénario.
+     *
+     * Les lignes vides, les commentaires et les types inconnus sont ignorés,
+     * comme dans la lecture par flux d'origine.
+     *
+     * \param[in] p_debut Premier caractère de la ligne.
+     * \param[in] p_fin Position du '\n' (ou fin du fichier).
+     * \param[out] p_modeles Reçoit l'enregistrement s'il s'agit d'un MODELE.
+     * \param[out] p_drones Reçoit l'enregistrement s'il s'agit d'un DRONE.
+     * \param[out] p_colis Reçoit l'enregistrement s'il s'agit d'un COLIS.
+     */
+void LecteurScenario::analyserLigne(const char* p_debut, const char* p_fin,
+                                    vector<EnregistrementModele>& p_modeles,
+                                    vector<EnregistrementDrone>& p_drones,
+                                    vector<EnregistrementColis>& p_colis) const
+{
+    if (p_fin != p_debut && *(p_fin - 1) == '\r')
+        --p_fin;
+    if (p_debut == p_fin || *p_debut == '#')
+        return;
+
+    size_t octet = static_cast<size_t>(p_debut - m_fichier.reqDonnees());
+    const char* curseur = p_debut;
+    string_view type = lireMot(curseur, p_fin);
+
+    if (type == "DRONE")
+    {
+        EnregistrementDrone drone{0, string_view(), 0.0, octet};
+        if (!lireEntier(curseur, p_fin, drone.id) || drone.id <= 0)
+            signalerLigneInvalide(octet, "DRONE");
+        drone.modele = lireMot(curseur, p_fin);
+        if (drone.modele.empty())
+            signalerLigneInvalide(octet, "DRONE");
+        // Sans charge utile, le drone prend celle de son modèle.
+        sauterEspaces(curseur, p_fin);
+        if (curseur != p_fin && (!lireReel(curseur, p_fin, drone.chargeMax) || drone.chargeMax <= 0.0))
+            signalerLigneInvalide(octet, "DRONE");
+        p_drones.push_back(drone);
+    }
+    else if (type == "MODELE")
+    {
+        EnregistrementModele modele{lireMot(curseur, p_fin), 0.0, 0.0, 0.0, 0.0, octet};
+        if (modele.nom.empty()
+            || !lireReel(curseur, p_fin, modele.chargeMax) || !lireReel(curseur, p_fin, modele.vitesse)
+            || !lireReel(curseur, p_fin, modele.autonomie) || !lireReel(curseur, p_fin, modele.rotation)
+            || modele.chargeMax <= 0.0 || modele.vitesse <= 0.0 || modele.autonomie <= 0.0 || modele.rotation < 0.0)
+            signalerLigneInvalide(octet, "MODELE");
+        p_modeles.push_back(modele);
+    }
+    else if (type == "COLIS")
+    {
+        EnregistrementColis colis{0, 0.0, string_view(), octet};
+        if (!lireEntier(curseur, p_fin, colis.id) || !lireReel(curseur, p_fin, colis.poids)
+            || colis.id <= 0 || !(colis.poids > 0.0))
+            signalerLigneInvalide(octet, "COLIS");
+        while (curseur != p_fin && (*curseur == ' ' || *curseur == '\t'))
+            ++curseur;
+        if (curseur == p_fin)
+            signalerLigneInvalide(octet, "COLIS");
+        colis.destination = string_view(curseur, static_cast<size_t>(p_fin - curseur));
+        p_colis.push_back(colis);
+    }
+}
+
+    /**
+     * \brief Retourne les modèles lus.
+     *
+     * \return Les enregistrements MODELE dans l'ordre du fichier.
+     */
+const vector<EnregistrementModele>& LecteurScenario::reqModeles() const
+{
+    return m_modeles;
+}
+
+    /**
+     * \brief Retourne les drones lus.
+     *
+     * \return Les enregistrements DRONE dans l'ordre du fichier.
+     */
+const vector<EnregistrementDrone>& LecteurScenario::reqDrones() const
+{
+    return m_drones;
+}
+
+    /**
+     * \brief Retourne les colis lus.
+     *
+     * \return Les enregistrements COLIS dans l'ordre du fichier.
+     */
+const vector<EnregistrementColis>& LecteurScenario::reqColis() const
+{
+    return m_colis;
+}
+
+    /**
+     * \brief Retourne le fichier projeté.
+     *
+     * \return La projection, valide tant que le lecteur existe.
+     */
+const FichierProjete& LecteurScenario::reqFichier() const
+{
+    return m_fichier;
+}
+
+} // namespace microdrone
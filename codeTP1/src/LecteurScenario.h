@@ -0,0 +1,155 @@
+/**
+ * \file LecteurScenario.h
+ * \brief Déclaration du lecteur de scénario projeté en mémoire.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef LECTEURSCENARIO_H_DEJA_INCLU
+#define LECTEURSCENARIO_H_DEJA_INCLU
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace microdrone
+{
+
+/**
+ * \brief Enregistrement MODELE lu dans le fichier, sans copie du nom.
+ */
+struct EnregistrementModele
+{
+    std::string_view nom;      //!< Nom du modèle, pointe dans le fichier projeté.
+    double chargeMax;          //!< Charge utile maximale en kg.
+    double vitesse;            //!< Vitesse de croisière en km/h.
+    double autonomie;          //!< Autonomie de la batterie en minutes de vol.
+    double rotation;           //!< Temps au sol entre deux sorties, en minutes.
+    std::size_t octet;         //!< Position de la ligne dans le fichier.
+};
+
+/**
+ * \brief Enregistrement DRONE lu dans le fichier, sans copie du modèle.
+ */
+struct EnregistrementDrone
+{
+    int id;                    //!< Identifiant du drone.
+    std::string_view modele;   //!< Modèle, pointe dans le fichier projeté.
+    double chargeMax;          //!< Charge utile maximale en kg (0 : celle du modèle).
+    std::size_t octet;         //!< Position de la ligne dans le fichier.
+};
+
+/**
+ * \brief Enregistrement COLIS lu dans le fichier, sans copie de la destination.
+ */
+struct EnregistrementColis
+{
+    int id;                        //!< Identifiant du colis.
+    double poids;                  //!< Poids en kg.
+    std::string_view destination;  //!< Destination, pointe dans le fichier projeté.
+    std::size_t octet;             //!< Position de la ligne dans le fichier.
+};
+
+/**
+ * \class FichierProjete
+ * \brief Projette un fichier en lecture seule dans l'espace mémoire du processus.
+ */
+class FichierProjete
+{
+public:
+    /**
+     * \brief Ouvre et projette le fichier.
+     */
+    explicit FichierProjete(const std::string& p_nomFichier);
+    ~FichierProjete();
+
+    FichierProjete(const FichierProjete&) = delete;
+    FichierProjete& operator=(const FichierProjete&) = delete;
+
+    /**
+     * \brief Retourne le début du contenu projeté.
+     */
+    const char* reqDonnees() const;
+
+    /**
+     * \brief Retourne la taille du contenu en octets.
+     */
+    std::size_t reqTaille() const;
+
+private:
+    const char* m_donnees;     //!< Début de la projection (nullptr si fichier vide).
+    std::size_t m_taille;      //!< Taille du fichier.
+#ifdef _WIN32
+    void* m_fichier;           //!< Poignée du fichier.
+    void* m_projection;        //!< Poignée de l'objet de projection.
+#endif
+};
+
+/**
+ * \class LecteurScenario
+ * \brief Analyse un fichier de scénario directement dans sa projection mémoire.
+ *
+ * Le format reconnu est celui de Gestionnaire::chargerScenario :
+ * lignes MODELE, DRONE et COLIS, lignes vides et commentaires débutant par '#'.
+ * Les scénarios convertis au format binaire (ScenarioBinaire.h) sont aussi acceptés.
+ * Les modèles et destinations restent des vues sur le fichier projeté;
+ * elles sont valides tant que le lecteur existe.
+ *
+ * En mode parallèle, le fichier est découpé en tranches alignées sur les fins
+ * de ligne; chaque tranche est analysée par son propre fil puis les résultats
+ * sont concaténés dans l'ordre des tranches, ce qui donne exactement le même
+ * résultat qu'une lecture séquentielle.
+ */
+class LecteurScenario
+{
+public:
+    /**
+     * \brief Projette le fichier de scénario.
+     */
+    explicit LecteurScenario(const std::string& p_nomFichier);
+
+    /**
+     * \brief Analyse tout le fichier, éventuellement sur plusieurs fils.
+     */
+    void analyser(unsigned int p_nbFils = 1);
+
+    /**
+     * \brief Retourne les modèles lus, dans l'ordre du fichier.
+     */
+    const std::vector<EnregistrementModele>& reqModeles() const;
+
+    /**
+     * \brief Retourne les drones lus, dans l'ordre du fichier.
+     */
+    const std::vector<EnregistrementDrone>& reqDrones() const;
+
+    /**
+     * \brief Retourne les colis lus, dans l'ordre du fichier.
+     */
+    const std::vector<EnregistrementColis>& reqColis() const;
+
+    /**
+     * \brief Retourne le fichier projeté, pour un décodage sans enregistrements.
+     */
+    const FichierProjete& reqFichier() const;
+
+private:
+    void analyserTranche(const char* p_debut, const char* p_fin,
+                         std::vector<EnregistrementModele>& p_modeles,
+                         std::vector<EnregistrementDrone>& p_drones,
+                         std::vector<EnregistrementColis>& p_colis) const;
+    void analyserLigne(const char* p_debut, const char* p_fin,
+                       std::vector<EnregistrementModele>& p_modeles,
+                       std::vector<EnregistrementDrone>& p_drones,
+                       std::vector<EnregistrementColis>& p_colis) const;
+
+    FichierProjete m_fichier;                    //!< Contenu projeté du scénario.
+    std::vector<EnregistrementModele> m_modeles; //!< Modèles lus.
+    std::vector<EnregistrementDrone> m_drones;   //!< Drones lus.
+    std::vector<EnregistrementColis> m_colis;    //!< Colis lus.
+};
+
+} // namespace microdrone
+
+#endif // LECTEURSCENARIO_H_DEJA_INCLU
@@ -0,0 +1,242 @@
+/**
+ * \file MesurerAffectation.cpp
+ * \brief Mesure du couplage de coût minimal contre le premier et le meilleur ajustement.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : MesurerAffectation [drones] [colis...]
+ *
+ * Pour chaque nombre de colis (900, 1 000 et 4 000 par défaut, pour 1 000
+ * drones : des drones de trop, autant que de colis, quatre colis par drone),
+ * l'outil génère un scénario, puis, pour chaque stratégie d'affectation en
+ * mode DIFFERE :
+ *  - chronomètre la première planification, meilleur de trois chargements,
+ *    et en tire le débit en colis examinés par seconde;
+ *  - compte les missions planifiées et les colis différés par cette
+ *    première passe, et la charge utile gaspillée (chargeMax - poids) par
+ *    mission, à partir des notifications;
+ *  - compte les tours (planification, lancement, fin de toutes les
+ *    missions) nécessaires pour livrer tous les colis.
+ * Les gains sont comparés au premier ajustement : missions de plus, en %,
+ * et gaspillage par mission en moins, en %. Le code de retour est 1 si une
+ * stratégie affecte un colis à un drone trop faible ou ne livre pas tous les
+ * colis.
+ */
+#include "GenerateurScenario.h"
+#include "Gestionnaire.h"
+#include "LecteurScenario.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+const int NB_ESSAIS = 3;
+const chrono::microseconds BUDGET_COUPLAGE(2000);
+
+struct Configuration
+{
+    const char* nom;
+    StrategieAffectation strategie;
+    size_t fenetre;  // Colis par couplage, pour OPTIMALE seulement.
+};
+
+struct Resultat
+{
+    double duree = 0.0;         // Meilleure première planification, en secondes.
+    size_t colisExamines = 0;
+    size_t missions = 0;        // Missions de la première passe.
+    size_t differes = 0;        // Colis sans drone à leur mesure à la première passe.
+    double gaspillage = 0.0;    // Charge utile gaspillée par ces missions, en kg.
+    size_t replis = 0;          // Fenêtres dont le couplage a dépassé son budget.
+    size_t tours = 0;
+    bool valide = true;
+};
+
+    /**
+     * \brief Charges utiles des drones et poids des colis du scénario, par identifiant.
+     */
+struct Reference
+{
+    unordered_map<int, double> chargesMax;
+    unordered_map<int, double> poids;
+    vector<int> dronesIds;
+};
+
+Reference lireReference(const string& p_nomFichier)
+{
+    LecteurScenario lecteur(p_nomFichier);
+    lecteur.analyser(0);
+    unordered_map<string, double> chargesModeles;
+    for (const EnregistrementModele& modele : lecteur.reqModeles())
+        chargesModeles[string(modele.nom)] = modele.chargeMax;
+    Reference reference;
+    for (const EnregistrementDrone& drone : lecteur.reqDrones())
+    {
+        reference.chargesMax[drone.id] = drone.chargeMax > 0.0 ? drone.chargeMax
+                                                               : chargesModeles.at(string(drone.modele));
+        reference.dronesIds.push_back(drone.id);
+    }
+    for (const EnregistrementColis& colis : lecteur.reqColis())
+        reference.poids[colis.id] = colis.poids;
+    return reference;
+}
+
+void configurer(Gestionnaire& p_gestionnaire, const Configuration& p_configuration, size_t p_nbColis,
+                ostream& p_muet)
+{
+    p_gestionnaire.definirSortie(p_muet);
+    p_gestionnaire.definirNbFilsChargement(0);
+    p_gestionnaire.definirModePlanification(ModePlanification::DIFFERE);
+    p_gestionnaire.definirStrategieAffectation(p_configuration.strategie);
+    if (p_configuration.fenetre > 0)
+        p_gestionnaire.definirFenetreOptimale(p_configuration.fenetre, BUDGET_COUPLAGE);
+    // Une notification par colis examiné, plus une par repli.
+    p_gestionnaire.definirJournalNotifications(2 * p_nbColis + 16, PolitiqueDebordement::REJETER_NOUVELLES);
+}
+
+Resultat mesurer(const string& p_nomFichier, const Configuration& p_configuration, const Reference& p_reference)
+{
+    ostream muet(nullptr);
+    const size_t nbColis = p_reference.poids.size();
+    Resultat resultat;
+
+    // Première passe, chronométrée sur plusieurs chargements; la qualité est
+    // celle du dernier, toutes les passes étant déterministes.
+    for (int essai = 0; essai < NB_ESSAIS; ++essai)
+    {
+        Gestionnaire gestionnaire;
+        configurer(gestionnaire, p_configuration, nbColis, muet);
+        gestionnaire.chargerScenario(p_nomFichier);
+        resultat.colisExamines = gestionnaire.reqCompteurs().colisEnAttente;
+        const auto debut = chrono::steady_clock::now();
+        gestionnaire.planifierMissions();
+        const double duree = chrono::duration<double>(chrono::steady_clock::now() - debut).count();
+        resultat.duree = essai == 0 ? duree : min(resultat.duree, duree);
+
+        if (essai + 1 < NB_ESSAIS)
+            continue;
+        const JournalNotifications& journal = gestionnaire.reqNotifications();
+        for (size_t i = 0; i < journal.taille(); ++i)
+        {
+            const Notification& notification = journal[i];
+            if (notification.type == TypeNotification::REPLI_PREMIER_AJUSTEMENT)
+                resultat.replis++;
+            if (notification.type == TypeNotification::COLIS_DIFFERE)
+                resultat.differes++;
+            if (notification.type != TypeNotification::MISSION_PLANIFIEE)
+                continue;
+            const double gaspille = p_reference.chargesMax.at(notification.droneId)
+                                    - p_reference.poids.at(notification.colisId);
+            resultat.valide = resultat.valide && gaspille >= 0.0;
+            resultat.missions++;
+            resultat.gaspillage += gaspille;
+        }
+
+        // Tours jusqu'à la livraison de tous les colis; la fin d'une mission
+        // donne aussitôt au drone un colis différé.
+        gestionnaire.definirNotificationsActives(false);
+        resultat.tours = 1;
+        for (StatistiquesFlotte compteurs = gestionnaire.reqCompteurs();
+             compteurs.missionsPlanifiees + compteurs.colisEnAttente + compteurs.colisDifferes > 0;
+             compteurs = gestionnaire.reqCompteurs())
+        {
+            if (resultat.tours > nbColis)
+            {
+                resultat.valide = false;
+                break;
+            }
+            gestionnaire.lancerToutesMissions();
+            for (int droneId : p_reference.dronesIds)
+                gestionnaire.terminerMission(droneId);
+            if (gestionnaire.reqCompteurs().colisEnAttente > 0)
+                gestionnaire.planifierMissions();
+            resultat.tours++;
+        }
+        resultat.valide = resultat.valide && gestionnaire.reqCompteurs().missionsTerminees == nbColis;
+    }
+    return resultat;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    const long long nbDrones = argc > 1 ? atoll(argv[1]) : 1000;
+    vector<long long> tailles;
+    for (int i = 2; i < argc; ++i)
+        tailles.push_back(atoll(argv[i]));
+    if (tailles.empty())
+        tailles = {nbDrones * 9 / 10, nbDrones, nbDrones * 4};
+    if (nbDrones <= 0 || any_of(tailles.begin(), tailles.end(), [](long long p_nb) { return p_nb <= 0; }))
+    {
+        cerr << "Utilisation : " << argv[0] << " [drones] [colis...]" << endl;
+        return 2;
+    }
+
+    const Configuration configurations[] = {
+        {"premier ajustement", StrategieAffectation::PREMIER_AJUSTEMENT, 0},
+        {"meilleur ajustement", StrategieAffectation::MEILLEUR_AJUSTEMENT, 0},
+        {"optimale K=8", StrategieAffectation::OPTIMALE, 8},
+        {"optimale K=32", StrategieAffectation::OPTIMALE, 32},
+        {"optimale K=128", StrategieAffectation::OPTIMALE, 128},
+    };
+
+    const string nomFichier = "MesurerAffectation.scenario.txt";
+    bool toutValide = true;
+    try
+    {
+        cout << "Drones : " << nbDrones << ", mode DIFFERE, budget du couplage : " << BUDGET_COUPLAGE.count()
+             << " us; gains comparés au premier ajustement\n";
+        for (long long nbColis : tailles)
+        {
+            genererScenario(nomFichier, static_cast<size_t>(nbDrones), static_cast<size_t>(nbColis));
+            const Reference reference = lireReference(nomFichier);
+            cout << "\n" << nbColis << " colis\n"
+                 << "stratégie            durée (ms)    colis/s  missions  différés  kg gaspillés/mission"
+                 << "  replis  tours  gain missions  gain gaspillage  bilan\n";
+            Resultat premier;
+            for (const Configuration& configuration : configurations)
+            {
+                const Resultat resultat = mesurer(nomFichier, configuration, reference);
+                if (configuration.strategie == StrategieAffectation::PREMIER_AJUSTEMENT)
+                    premier = resultat;
+                toutValide = toutValide && resultat.valide;
+                auto parMission = [](const Resultat& p_resultat)
+                {
+                    return p_resultat.missions == 0 ? 0.0
+                                                    : p_resultat.gaspillage / static_cast<double>(p_resultat.missions);
+                };
+                const double gainMissions = premier.missions == 0 ? 0.0
+                    : 100.0 * (static_cast<double>(resultat.missions) / static_cast<double>(premier.missions) - 1.0);
+                const double gainGaspillage = parMission(premier) == 0.0 ? 0.0
+                    : 100.0 * (1.0 - parMission(resultat) / parMission(premier));
+                cout << setw(19) << left << configuration.nom << right << fixed << setprecision(3) << setw(12)
+                     << resultat.duree * 1e3 << setprecision(0) << setw(11)
+                     << resultat.colisExamines / resultat.duree << setw(10) << resultat.missions << setw(10)
+                     << resultat.differes << setprecision(3) << setw(22) << parMission(resultat) << setw(8)
+                     << resultat.replis << setw(7) << resultat.tours << setprecision(2) << setw(14)
+                     << gainMissions << "%" << setw(16) << gainGaspillage << "%  "
+                     << (resultat.valide ? "ok" : "INVALIDE") << endl;
+            }
+        }
+    }
+    catch (const exception& e)
+    {
+        remove(nomFichier.c_str());
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    remove(nomFichier.c_str());
+    return toutValide ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+/**
+ * \file MesurerAnalyse.cpp
+ * \brief Outil de mesure de l'analyse parallèle des scénarios selon le nombre de fils.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : MesurerAnalyse [lignes] [fils_max] [repetitions]
+ *
+ * L'outil génère un scénario texte d'environ lignes lignes (10 millions par
+ * défaut, un drone pour neuf colis), puis l'analyse avec 1, 2, 4, ... jusqu'à
+ * fils_max (32 par défaut) fils et garde le meilleur temps de repetitions
+ * essais (3 par défaut). Il vérifie que chaque analyse donne exactement les
+ * enregistrements de l'analyse séquentielle et écrit une ligne par nombre de
+ * fils. Le code de retour est 1 si une analyse diffère.
+ */
+#include "GenerateurScenario.h"
+#include "LecteurScenario.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+    /**
+     * \brief Résume les enregistrements lus en une empreinte qui dépend de leur ordre.
+     */
+uint64_t empreinte(const LecteurScenario& p_lecteur)
+{
+    uint64_t h = 1469598103934665603ull;
+    auto melanger = [&h](uint64_t p_valeur) { h = (h ^ p_valeur) * 1099511628211ull; };
+    for (const EnregistrementDrone& drone : p_lecteur.reqDrones())
+    {
+        melanger(static_cast<uint64_t>(drone.id));
+        melanger(drone.octet);
+    }
+    for (const EnregistrementColis& colis : p_lecteur.reqColis())
+    {
+        uint64_t poids;
+        memcpy(&poids, &colis.poids, sizeof(poids));
+        melanger(static_cast<uint64_t>(colis.id));
+        melanger(poids);
+        melanger(colis.octet);
+    }
+    return h;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 4)
+    {
+        cerr << "Utilisation : " << argv[0] << " [lignes] [fils_max] [repetitions]" << endl;
+        return 2;
+    }
+    const long long nbLignes = argc > 1 ? atoll(argv[1]) : 10000000;
+    const unsigned int nbFilsMax = argc > 2 ? static_cast<unsigned int>(atoi(argv[2])) : 32;
+    const int nbRepetitions = argc > 3 ? atoi(argv[3]) : 3;
+    if (nbLignes <= 0 || nbFilsMax == 0 || nbRepetitions <= 0)
+    {
+        cerr << "Erreur : lignes, fils_max et repetitions doivent être positifs" << endl;
+        return 2;
+    }
+
+    const string nomFichier = "MesurerAnalyse.scenario.txt";
+    bool toutIdentique = true;
+    try
+    {
+        const size_t nbDrones = max<size_t>(1, static_cast<size_t>(nbLignes) / 10);
+        const size_t nbColis = static_cast<size_t>(nbLignes) - min(nbDrones, static_cast<size_t>(nbLignes));
+        genererScenario(nomFichier, nbDrones, nbColis);
+
+        cout << "Coeurs : " << thread::hardware_concurrency() << ", drones : " << nbDrones
+             << ", colis : " << nbColis << "\n"
+             << "     fils  durée (s)  lignes/s  accélération  bilan\n";
+        uint64_t reference = 0;
+        double dureeReference = 0.0;
+        for (unsigned int nbFils = 1; nbFils <= nbFilsMax; nbFils *= 2)
+        {
+            double meilleure = 0.0;
+            bool identique = true;
+            for (int essai = 0; essai < nbRepetitions; ++essai)
+            {
+                const auto debut = chrono::steady_clock::now();
+                LecteurScenario lecteur(nomFichier);
+                lecteur.analyser(nbFils);
+                const double duree = chrono::duration<double>(chrono::steady_clock::now() - debut).count();
+                meilleure = essai == 0 ? duree : min(meilleure, duree);
+
+                const uint64_t h = empreinte(lecteur);
+                if (nbFils == 1 && essai == 0)
+                    reference = h;
+                identique = identique && h == reference && lecteur.reqDrones().size() == nbDrones
+                            && lecteur.reqColis().size() == nbColis;
+            }
+            if (nbFils == 1)
+                dureeReference = meilleure;
+            toutIdentique = toutIdentique && identique;
+            cout << setw(9) << nbFils << fixed << setprecision(3) << setw(11) << meilleure << setprecision(0)
+                 << setw(10) << (nbDrones + nbColis) / meilleure << setprecision(2) << setw(14)
+                 << dureeReference / meilleure << "  " << (identique ? "ok" : "DIFFÉRENT") << endl;
+        }
+    }
+    catch (const exception& e)
+    {
+        remove(nomFichier.c_str());
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    remove(nomFichier.c_str());
+    return toutIdentique ? 0 : 1;
+}
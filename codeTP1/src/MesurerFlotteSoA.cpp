@@ -0,0 +1,158 @@
+/**
+ * \file MesurerFlotteSoA.cpp
+ * \brief Micro-mesure des parcours complets de flotte, tableau de Drone contre FlotteSoA.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : MesurerFlotteSoA [drones...]
+ *
+ * Pour chaque taille de flotte (10 000, 100 000 et 1 000 000 drones par
+ * défaut, un sur deux en vol), l'outil chronomètre deux parcours complets :
+ *  - le compte des drones libres, comme reqStatistiques le faisait;
+ *  - le compte des drones libres pouvant porter un poids donné, le test
+ *    d'éligibilité du planificateur.
+ * Chaque parcours est fait sur un std::vector<Drone> (objets complets), sur
+ * les tableaux de FlotteSoA et sur FlotteSoA par ses vues DroneVueConst. Les
+ * durées sont en nanosecondes par drone, meilleur de plusieurs passes. Le code
+ * de retour est 1 si les dispositions ne comptent pas les mêmes drones.
+ */
+#include "Colis.h"
+#include "Drone.h"
+#include "FlotteSoA.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+const double CHARGES[] = {1.5, 2.0, 2.5, 3.0};
+
+    /**
+     * \brief Retourne le meilleur temps par drone d'un parcours, en ns, et son dernier résultat.
+     */
+template <typename Parcours>
+double chronometrer(size_t p_nbDrones, Parcours p_parcours, size_t& p_resultat)
+{
+    // Assez de passes pour environ 50 millions de drones parcourus.
+    const size_t nbPasses = max<size_t>(5, 50000000 / p_nbDrones);
+    double meilleure = 0.0;
+    for (size_t passe = 0; passe < nbPasses; ++passe)
+    {
+        const double poids = 1.0 + static_cast<double>(passe % 16) / 8.0;
+        const auto debut = chrono::steady_clock::now();
+        p_resultat = p_parcours(poids);
+        const double duree = chrono::duration<double, nano>(chrono::steady_clock::now() - debut).count();
+        meilleure = passe == 0 ? duree : min(meilleure, duree);
+    }
+    return meilleure / static_cast<double>(p_nbDrones);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    vector<long long> tailles;
+    for (int i = 1; i < argc; ++i)
+        tailles.push_back(atoll(argv[i]));
+    if (tailles.empty())
+        tailles = {10000, 100000, 1000000};
+    for (long long taille : tailles)
+        if (taille <= 0)
+        {
+            cerr << "Utilisation : " << argv[0] << " [drones...]" << endl;
+            return 2;
+        }
+
+    bool toutIdentique = true;
+    try
+    {
+        const Colis colis(1, 0.5, "Destination");
+        cout << "sizeof(Drone) : " << sizeof(Drone) << " octets; durées en ns par drone\n"
+             << "           drones | libres : Drone  SoA  vues | éligibles : Drone  SoA  vues | bilan\n";
+        for (long long taille : tailles)
+        {
+            const size_t nbDrones = static_cast<size_t>(taille);
+            vector<Drone> tableau;
+            tableau.reserve(nbDrones);
+            FlotteSoA flotte;
+            flotte.reserver(nbDrones);
+            for (size_t rang = 0; rang < nbDrones; ++rang)
+            {
+                const int id = static_cast<int>(rang + 1);
+                tableau.emplace_back(id, "QuadX-100", CHARGES[rang % 4]);
+                flotte.ajouter(id, "QuadX-100", CHARGES[rang % 4]);
+                if (rang % 2 == 1)
+                {
+                    tableau.back().emporter(colis);
+                    flotte[rang].emporter(colis);
+                }
+            }
+            const FlotteSoA& flotteConst = flotte;
+
+            size_t libresDrone, libresSoA, libresVues, eligiblesDrone, eligiblesSoA, eligiblesVues;
+            const double tLibresDrone = chronometrer(nbDrones, [&](double)
+                {
+                    return static_cast<size_t>(count_if(tableau.begin(), tableau.end(),
+                                                        [](const Drone& p_drone) { return p_drone.estDisponible(); }));
+                }, libresDrone);
+            const double tLibresSoA = chronometrer(nbDrones, [&](double)
+                {
+                    const DroneEtat* etats = flotteConst.reqEtats();
+                    size_t nb = 0;
+                    for (size_t i = 0; i < nbDrones; ++i)
+                        nb += etats[i] == DroneEtat::LIBRE;
+                    return nb;
+                }, libresSoA);
+            const double tLibresVues = chronometrer(nbDrones, [&](double)
+                {
+                    size_t nb = 0;
+                    for (const DroneVueConst drone : flotteConst)
+                        nb += drone.estDisponible();
+                    return nb;
+                }, libresVues);
+            const double tEligiblesDrone = chronometrer(nbDrones, [&](double p_poids)
+                {
+                    size_t nb = 0;
+                    for (const Drone& drone : tableau)
+                        nb += drone.estDisponible() && drone.reqChargeMax() >= p_poids;
+                    return nb;
+                }, eligiblesDrone);
+            const double tEligiblesSoA = chronometrer(nbDrones, [&](double p_poids)
+                {
+                    const DroneEtat* etats = flotteConst.reqEtats();
+                    const double* charges = flotteConst.reqChargesMax();
+                    size_t nb = 0;
+                    for (size_t i = 0; i < nbDrones; ++i)
+                        nb += (etats[i] == DroneEtat::LIBRE) & (charges[i] >= p_poids);
+                    return nb;
+                }, eligiblesSoA);
+            const double tEligiblesVues = chronometrer(nbDrones, [&](double p_poids)
+                {
+                    size_t nb = 0;
+                    for (const DroneVueConst drone : flotteConst)
+                        nb += drone.estDisponible() && drone.reqChargeMax() >= p_poids;
+                    return nb;
+                }, eligiblesVues);
+
+            const bool identique = libresDrone == libresSoA && libresSoA == libresVues
+                                   && eligiblesDrone == eligiblesSoA && eligiblesSoA == eligiblesVues;
+            toutIdentique = toutIdentique && identique;
+            cout << setw(17) << nbDrones << fixed << setprecision(2) << setw(17) << tLibresDrone << setw(5)
+                 << tLibresSoA << setw(6) << tLibresVues << setw(20) << tEligiblesDrone << setw(5) << tEligiblesSoA
+                 << setw(6) << tEligiblesVues << " | " << (identique ? "ok" : "DIFFÉRENT") << endl;
+        }
+    }
+    catch (const exception& e)
+    {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    return toutIdentique ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+/**
+ * \file MesurerFormatBinaire.cpp
+ * \brief Outil comparant le chargement des scénarios texte et binaires.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : MesurerFormatBinaire [enregistrements...]
+ *
+ * Pour chaque nombre d'enregistrements (1, 10 et 50 millions par défaut, un
+ * drone pour neuf colis), l'outil génère un scénario texte, le convertit au
+ * format binaire comme ConvertirScenario, puis mesure :
+ *  - l'analyse seule (LecteurScenario::analyser) du texte sur un fil, du
+ *    texte sur tous les coeurs et du binaire;
+ *  - le chargement complet par Gestionnaire::chargerScenario des deux fichiers.
+ * Le chargement complet de 50 millions d'enregistrements demande plusieurs
+ * Go de mémoire. Le code de retour est 1 si les deux formats ne donnent pas
+ * les mêmes enregistrements ou les mêmes compteurs.
+ */
+#include "GenerateurScenario.h"
+#include "Gestionnaire.h"
+#include "LecteurScenario.h"
+#include "ScenarioBinaire.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+double secondesDepuis(chrono::steady_clock::time_point p_debut)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - p_debut).count();
+}
+
+double mesurerAnalyse(const string& p_nomFichier, unsigned int p_nbFils, size_t& p_nbEnregistrements)
+{
+    const auto debut = chrono::steady_clock::now();
+    LecteurScenario lecteur(p_nomFichier);
+    lecteur.analyser(p_nbFils);
+    const double duree = secondesDepuis(debut);
+    p_nbEnregistrements = lecteur.reqDrones().size() + lecteur.reqColis().size();
+    return duree;
+}
+
+double mesurerChargement(const string& p_nomFichier, StatistiquesFlotte& p_compteurs)
+{
+    ostream muet(nullptr);
+    Gestionnaire gestionnaire;
+    gestionnaire.definirSortie(muet);
+    gestionnaire.definirNbFilsChargement(0);
+    const auto debut = chrono::steady_clock::now();
+    gestionnaire.chargerScenario(p_nomFichier);
+    const double duree = secondesDepuis(debut);
+    p_compteurs = gestionnaire.reqCompteurs();
+    return duree;
+}
+
+size_t tailleFichier(const string& p_nomFichier)
+{
+    ifstream fichier(p_nomFichier, ios::binary | ios::ate);
+    return static_cast<size_t>(fichier.tellg());
+}
+}
+
+int main(int argc, char* argv[])
+{
+    vector<long long> tailles;
+    for (int i = 1; i < argc; ++i)
+        tailles.push_back(atoll(argv[i]));
+    if (tailles.empty())
+        tailles = {1000000, 10000000, 50000000};
+    for (long long taille : tailles)
+        if (taille <= 0)
+        {
+            cerr << "Utilisation : " << argv[0] << " [enregistrements...]" << endl;
+            return 2;
+        }
+
+    const string nomTexte = "MesurerFormatBinaire.scenario.txt";
+    const string nomBinaire = "MesurerFormatBinaire.scenario.bin";
+    bool toutIdentique = true;
+    try
+    {
+        cout << "Durées en secondes; gain : chargement texte / chargement binaire\n"
+             << "enregistrements  Mo texte  Mo binaire  analyse 1 fil  analyse N fils  analyse bin"
+             << "  chargement texte  chargement bin   gain  bilan\n";
+        for (long long taille : tailles)
+        {
+            const size_t nbDrones = max<size_t>(1, static_cast<size_t>(taille) / 10);
+            const size_t nbColis = static_cast<size_t>(taille) - min(nbDrones, static_cast<size_t>(taille));
+            genererScenario(nomTexte, nbDrones, nbColis);
+            {
+                LecteurScenario lecteur(nomTexte);
+                lecteur.analyser(0);
+                ecrireScenarioBinaire(nomBinaire, lecteur.reqModeles(), lecteur.reqDrones(), lecteur.reqColis());
+            }
+
+            size_t nbTexte1 = 0, nbTexteN = 0, nbBinaire = 0;
+            const double analyseTexte1 = mesurerAnalyse(nomTexte, 1, nbTexte1);
+            const double analyseTexteN = mesurerAnalyse(nomTexte, 0, nbTexteN);
+            const double analyseBinaire = mesurerAnalyse(nomBinaire, 1, nbBinaire);
+            StatistiquesFlotte compteursTexte, compteursBinaire;
+            const double chargementTexte = mesurerChargement(nomTexte, compteursTexte);
+            const double chargementBinaire = mesurerChargement(nomBinaire, compteursBinaire);
+
+            const bool identique = nbTexte1 == nbDrones + nbColis && nbTexteN == nbTexte1 && nbBinaire == nbTexte1
+                                   && compteursTexte.nbDrones == compteursBinaire.nbDrones
+                                   && compteursTexte.colisEnAttente == compteursBinaire.colisEnAttente;
+            toutIdentique = toutIdentique && identique;
+            cout << setw(15) << taille << fixed << setprecision(1) << setw(10) << tailleFichier(nomTexte) / 1e6
+                 << setw(12) << tailleFichier(nomBinaire) / 1e6 << setprecision(3) << setw(15) << analyseTexte1
+                 << setw(16) << analyseTexteN << setw(13) << analyseBinaire << setw(18) << chargementTexte
+                 << setw(16) << chargementBinaire << setprecision(1) << setw(7)
+                 << chargementTexte / chargementBinaire << "  " << (identique ? "ok" : "DIFFÉRENT") << endl;
+        }
+    }
+    catch (const exception& e)
+    {
+        remove(nomTexte.c_str());
+        remove(nomBinaire.c_str());
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    remove(nomTexte.c_str());
+    remove(nomBinaire.c_str());
+    return toutIdentique ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+/**
+ * \file MesurerFragments.cpp
+ * \brief Outil de mesure du débit de GestionnaireFragmente selon le nombre de fragments.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : MesurerFragments [drones] [colis] [fragments_max] [graine]
+ *
+ * Pour 1, 2, 4, ... jusqu'à fragments_max (64 par défaut) fragments, l'outil
+ * construit une flotte synthétique de charges 0,5, 1 et 2 kg, lance les fils
+ * de planification, puis autant de fils producteurs et de fils de fin de
+ * mission que de fragments. Il mesure le temps jusqu'à ce que tous les colis
+ * soient livrés et écrit une ligne par nombre de fragments : de quoi tracer
+ * la courbe de mise à l'échelle.
+ *
+ * Chaque relevé des compteurs pris pendant la mesure doit compter chaque
+ * colis soumis une seule fois (en attente, différé, refusé, en mission ou
+ * livré), et les identifiants des missions livrées doivent être uniques sur
+ * toute la flotte. Le code de retour est 1 si une ligne n'est pas « ok ».
+ */
+#include "GestionnaireFragmente.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+struct Mesure
+{
+    double duree = 0.0;             // Secondes, de la première soumission à la dernière livraison.
+    size_t nbLivres = 0;
+    size_t nbVoles = 0;
+    bool bilanExact = true;
+    bool relevesCoherents = true;   // Chaque relevé compte chaque colis soumis une fois.
+    bool idsUniques = true;         // Aucune mission livrée deux fois sous le même identifiant.
+};
+
+struct alignas(64) CompteurFil
+{
+    atomic<size_t> nb{0};
+};
+
+size_t sommer(const vector<CompteurFil>& p_compteurs)
+{
+    size_t total = 0;
+    for (const CompteurFil& compteur : p_compteurs)
+        total += compteur.nb.load(memory_order_acquire);
+    return total;
+}
+
+size_t colisComptes(const StatistiquesFlotte& p_compteurs)
+{
+    return p_compteurs.colisEnAttente + p_compteurs.colisDifferes + p_compteurs.colisRefuses
+           + p_compteurs.colisHorsPortee + p_compteurs.missionsPlanifiees + p_compteurs.missionsEnCours
+           + p_compteurs.missionsTerminees;
+}
+
+Mesure mesurer(size_t p_nbFragments, int p_nbDrones, int p_nbColis, unsigned int p_graine)
+{
+    const double charges[] = {0.5, 1.0, 2.0};
+    vector<DroneAtomique> drones;
+    drones.reserve(p_nbDrones);
+    for (int id = 1; id <= p_nbDrones; ++id)
+        drones.emplace_back(id, charges[id % 3]);
+
+    vector<double> poids(p_nbColis);
+    mt19937 generateur(p_graine);
+    uniform_real_distribution<double> loi(0.1, 2.0);
+    for (double& p : poids)
+        p = loi(generateur);
+
+    const size_t part = (static_cast<size_t>(p_nbColis) + p_nbFragments - 1) / p_nbFragments;
+    size_t capacite = GestionnaireFragmente::CAPACITE_DEFAUT;
+    while (capacite < 2 * part)
+        capacite <<= 1;
+    GestionnaireFragmente gestionnaire(p_nbFragments, capacite);
+    gestionnaire.chargerFlotte(move(drones));
+    gestionnaire.demarrer();
+
+    atomic<bool> fini(false);
+    vector<CompteurFil> tentes(p_nbFragments);     // Colis dont la soumission a commencé.
+    vector<CompteurFil> recus(p_nbFragments);      // Colis dont la soumission a réussi.
+    vector<vector<MissionId>> missionsLivrees(p_nbFragments);
+    vector<thread> fils;
+    const auto debut = chrono::steady_clock::now();
+    for (size_t f = 0; f < p_nbFragments; ++f)
+    {
+        fils.emplace_back([&, f]()
+                          {
+                              for (size_t id = f + 1; id <= static_cast<size_t>(p_nbColis); id += p_nbFragments)
+                              {
+                                  tentes[f].nb.fetch_add(1, memory_order_release);
+                                  while (!gestionnaire.soumettreColis(static_cast<int>(id), poids[id - 1]))
+                                      this_thread::yield();
+                                  recus[f].nb.fetch_add(1, memory_order_release);
+                              }
+                          });
+        fils.emplace_back([&, f]()
+                          {
+                              vector<MissionId>& livrees = missionsLivrees[f];
+                              livrees.reserve(2 * static_cast<size_t>(p_nbColis) / p_nbFragments + 1);
+                              while (!fini.load(memory_order_acquire))
+                              {
+                                  size_t nbTermines = 0;
+                                  for (size_t id = f + 1; id <= static_cast<size_t>(p_nbDrones); id += p_nbFragments)
+                                  {
+                                      MissionId missionId;
+                                      if (gestionnaire.terminerMission(static_cast<int>(id), missionId))
+                                      {
+                                          livrees.push_back(missionId);
+                                          nbTermines++;
+                                      }
+                                  }
+                                  if (nbTermines == 0)
+                                      this_thread::yield();
+                              }
+                          });
+    }
+    Mesure mesure;
+    for (;;)
+    {
+        // Les colis reçus avant le relevé y sont tous; ceux en cours de soumission, peut-être.
+        const size_t recusAvant = sommer(recus);
+        const StatistiquesFlotte releve = gestionnaire.reqCompteurs();
+        const size_t tentesApres = sommer(tentes);
+        const size_t comptes = colisComptes(releve);
+        mesure.relevesCoherents = mesure.relevesCoherents && recusAvant <= comptes && comptes <= tentesApres;
+        if (releve.missionsTerminees >= static_cast<size_t>(p_nbColis))
+            break;
+        this_thread::sleep_for(chrono::microseconds(200));
+    }
+    const auto fin = chrono::steady_clock::now();
+    fini.store(true, memory_order_release);
+    for (thread& fil : fils)
+        fil.join();
+    gestionnaire.arreter();
+
+    mesure.duree = chrono::duration<double>(fin - debut).count();
+    const StatistiquesFlotte compteurs = gestionnaire.reqCompteurs();
+    mesure.nbLivres = compteurs.missionsTerminees;
+    mesure.nbVoles = gestionnaire.reqNbColisVoles();
+    mesure.bilanExact = compteurs.dronesDisponibles == compteurs.nbDrones && compteurs.colisEnAttente == 0
+                        && compteurs.colisDifferes == 0 && compteurs.colisRefuses == 0;
+
+    vector<MissionId> identifiants;
+    identifiants.reserve(static_cast<size_t>(p_nbColis));
+    for (const vector<MissionId>& livrees : missionsLivrees)
+        identifiants.insert(identifiants.end(), livrees.begin(), livrees.end());
+    sort(identifiants.begin(), identifiants.end());
+    mesure.idsUniques = identifiants.size() == mesure.nbLivres
+                        && adjacent_find(identifiants.begin(), identifiants.end()) == identifiants.end();
+    return mesure;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 5)
+    {
+        cerr << "Utilisation : " << argv[0] << " [drones] [colis] [fragments_max] [graine]" << endl;
+        return 2;
+    }
+    const int nbDrones = argc > 1 ? atoi(argv[1]) : 100000;
+    const int nbColis = argc > 2 ? atoi(argv[2]) : 1000000;
+    const size_t nbFragmentsMax = argc > 3 ? static_cast<size_t>(atoi(argv[3])) : 64;
+    const unsigned int graine = argc > 4 ? static_cast<unsigned int>(atoi(argv[4])) : 1u;
+    if (nbDrones <= 0 || nbColis <= 0 || nbFragmentsMax == 0)
+    {
+        cerr << "Erreur : drones, colis et fragments_max doivent être positifs" << endl;
+        return 2;
+    }
+
+    bool toutValide = true;
+    try
+    {
+        cout << "Coeurs : " << thread::hardware_concurrency() << ", drones : " << nbDrones
+             << ", colis : " << nbColis << "\n"
+             << "fragments  durée (s)  colis/s  accélération  colis volés  bilan\n";
+        double reference = 0.0;
+        for (size_t nbFragments = 1; nbFragments <= nbFragmentsMax; nbFragments *= 2)
+        {
+            const Mesure mesure = mesurer(nbFragments, nbDrones, nbColis, graine);
+            const double debit = mesure.nbLivres / mesure.duree;
+            if (nbFragments == 1)
+                reference = debit;
+            const char* bilan = !mesure.bilanExact || !mesure.relevesCoherents ? "INCOHÉRENT"
+                                : !mesure.idsUniques ? "MISSION EN DOUBLE" : "ok";
+            toutValide = toutValide && mesure.bilanExact && mesure.relevesCoherents && mesure.idsUniques;
+            cout << setw(9) << nbFragments << fixed << setprecision(3) << setw(11) << mesure.duree
+                 << setprecision(0) << setw(9) << debit << setprecision(2) << setw(14) << debit / reference
+                 << setw(13) << mesure.nbVoles << "  " << bilan << endl;
+        }
+    }
+    catch (const exception& e)
+    {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    return toutValide ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+/**
+ * \file MesurerNoyauEligibilite.cpp
+ * \brief Mesure du noyau d'éligibilité contre la boucle par Drone.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : MesurerNoyauEligibilite [drones...]
+ *
+ * Pour chaque taille de flotte (10 000, 100 000 et 1 000 000 drones par
+ * défaut, un sur deux en vol), l'outil calcule le masque des drones libres
+ * pouvant porter un poids :
+ *  - par la boucle par Drone d'avant le noyau, sur un std::vector<Drone>;
+ *  - par NoyauEligibilite::calculer, un poids à la fois, puis par
+ *    calculerLot, huit poids par passe, avec chaque jeu d'instructions que
+ *    le processeur supporte.
+ * Les durées sont en nanosecondes par drone et par poids, meilleur de
+ * plusieurs passes. Le code de retour est 1 si un masque diffère de celui
+ * de la boucle par Drone.
+ */
+#include "Colis.h"
+#include "Drone.h"
+#include "FlotteSoA.h"
+#include "NoyauEligibilite.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+const double CHARGES[] = {1.5, 2.0, 2.5, 3.0};
+const size_t NB_POIDS = 8;  // Poids d'un lot, comme TAILLE_LOT_VECTORIEL du gestionnaire.
+
+const char* nomJeu(JeuInstructions p_jeu)
+{
+    switch (p_jeu)
+    {
+    case JeuInstructions::SCALAIRE:
+        return "scalaire";
+    case JeuInstructions::SSE2:
+        return "SSE2";
+    case JeuInstructions::AVX2:
+        return "AVX2";
+    }
+    return "?";
+}
+
+    /**
+     * \brief Retourne le meilleur temps d'un calcul, en ns par drone et par poids.
+     */
+template <typename Calcul>
+double chronometrer(size_t p_nbDrones, size_t p_nbPoids, Calcul p_calcul)
+{
+    // Assez de passes pour environ 50 millions de comparaisons.
+    const size_t nbPasses = max<size_t>(5, 50000000 / (p_nbDrones * p_nbPoids));
+    double meilleure = 0.0;
+    for (size_t passe = 0; passe < nbPasses; ++passe)
+    {
+        const auto debut = chrono::steady_clock::now();
+        p_calcul();
+        const double duree = chrono::duration<double, nano>(chrono::steady_clock::now() - debut).count();
+        meilleure = passe == 0 ? duree : min(meilleure, duree);
+    }
+    return meilleure / static_cast<double>(p_nbDrones * p_nbPoids);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    vector<long long> tailles;
+    for (int i = 1; i < argc; ++i)
+        tailles.push_back(atoll(argv[i]));
+    if (tailles.empty())
+        tailles = {10000, 100000, 1000000};
+    for (long long taille : tailles)
+        if (taille <= 0)
+        {
+            cerr << "Utilisation : " << argv[0] << " [drones...]" << endl;
+            return 2;
+        }
+
+    const double poids[NB_POIDS] = {0.4, 1.2, 1.6, 1.9, 2.1, 2.4, 2.7, 2.9};
+    vector<JeuInstructions> jeux;
+    const JeuInstructions meilleur = NoyauEligibilite::detecterJeuInstructions();
+    for (JeuInstructions jeu : {JeuInstructions::SCALAIRE, JeuInstructions::SSE2, JeuInstructions::AVX2})
+        if (static_cast<int>(jeu) <= static_cast<int>(meilleur))
+            jeux.push_back(jeu);
+
+    bool toutIdentique = true;
+    try
+    {
+        const Colis colis(1, 0.3, "Destination");
+        cout << "Meilleur jeu d'instructions : " << nomJeu(meilleur) << "; durées en ns par drone et par poids\n"
+             << "           drones  méthode          1 poids  8 poids  accélération  bilan\n";
+        for (long long taille : tailles)
+        {
+            const size_t nbDrones = static_cast<size_t>(taille);
+            const size_t nbMots = NoyauEligibilite::nbMots(nbDrones);
+            vector<Drone> tableau;
+            tableau.reserve(nbDrones);
+            FlotteSoA flotte;
+            flotte.reserver(nbDrones);
+            for (size_t rang = 0; rang < nbDrones; ++rang)
+            {
+                const int id = static_cast<int>(rang + 1);
+                tableau.emplace_back(id, "QuadX-100", CHARGES[rang % 4]);
+                flotte.ajouter(id, "QuadX-100", CHARGES[rang % 4]);
+                if (rang % 2 == 1)
+                {
+                    tableau.back().emporter(colis);
+                    flotte[rang].emporter(colis);
+                }
+            }
+
+            // Référence : la boucle par Drone, un poids à la fois.
+            vector<uint64_t> reference(nbMots * NB_POIDS);
+            auto boucleParDrone = [&](size_t p_premier, size_t p_nb)
+            {
+                for (size_t k = p_premier; k < p_premier + p_nb; ++k)
+                {
+                    uint64_t* masque = &reference[k * nbMots];
+                    fill(masque, masque + nbMots, 0);
+                    for (size_t rang = 0; rang < nbDrones; ++rang)
+                        if (tableau[rang].estDisponible() && tableau[rang].reqChargeMax() >= poids[k])
+                            masque[rang / 64] |= uint64_t(1) << (rang % 64);
+                }
+            };
+            const double tBoucle1 = chronometrer(nbDrones, 1, [&]() { boucleParDrone(0, 1); });
+            const double tBoucle8 = chronometrer(nbDrones, NB_POIDS, [&]() { boucleParDrone(0, NB_POIDS); });
+            cout << setw(17) << nbDrones << "  " << setw(15) << left << "boucle Drone" << right << fixed
+                 << setprecision(3) << setw(9) << tBoucle1 << setw(9) << tBoucle8 << setprecision(1) << setw(14) << 1.0
+                 << setprecision(3) << "  ok\n";
+
+            vector<uint64_t> masques(nbMots * NB_POIDS);
+            for (JeuInstructions jeu : jeux)
+            {
+                const NoyauEligibilite noyau(jeu);
+                const double t1 = chronometrer(nbDrones, 1, [&]()
+                    {
+                        noyau.calculer(flotte.reqChargesMax(), flotte.reqEtats(), nbDrones, poids[0], masques.data());
+                    });
+                bool identique = equal(masques.begin(), masques.begin() + nbMots, reference.begin());
+                const double t8 = chronometrer(nbDrones, NB_POIDS, [&]()
+                    {
+                        noyau.calculerLot(flotte.reqChargesMax(), flotte.reqEtats(), nbDrones, poids, NB_POIDS,
+                                          masques.data());
+                    });
+                identique = identique && masques == reference;
+                toutIdentique = toutIdentique && identique;
+                cout << setw(17) << "" << "  " << setw(15) << left << (string("noyau ") + nomJeu(jeu)) << right
+                     << setw(9) << t1 << setw(9) << t8 << setprecision(1) << setw(14) << tBoucle8 / t8
+                     << setprecision(3) << "  " << (identique ? "ok" : "DIFFÉRENT") << "\n";
+            }
+            cout << flush;
+        }
+    }
+    catch (const exception& e)
+    {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    return toutIdentique ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+/**
+ * \file MesurerRoueTemporelle.cpp
+ * \brief Mesure de la roue temporelle contre un tas binaire de minuteries.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : MesurerRoueTemporelle [minuteries...]
+ *
+ * Pour chaque nombre de minuteries en attente (1 000 000 par défaut), à
+ * échéances aléatoires sur 4 ticks par minuterie, l'outil chronomètre trois
+ * phases, sur RoueTemporelle puis sur un tas binaire (std::priority_queue)
+ * dont les annulations ne font que marquer la minuterie :
+ *  - la programmation de toutes les minuteries;
+ *  - l'annulation de la moitié d'entre elles, dans un ordre aléatoire;
+ *  - l'expiration des autres, en avançant jusqu'à la dernière échéance.
+ * Les durées sont en nanosecondes par opération, meilleur de trois essais.
+ * Le code de retour est 1 si une minuterie expire hors de son échéance ou si
+ * les deux structures ne font pas expirer les mêmes minuteries.
+ */
+#include "RoueTemporelle.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+const int NB_ESSAIS = 3;
+
+struct Durees
+{
+    double programmation = 0.0;     // ns par minuterie programmée.
+    double annulation = 0.0;        // ns par minuterie annulée.
+    double expiration = 0.0;        // ns par minuterie expirée.
+    size_t nbExpirees = 0;
+    uint64_t somme = 0;             // Somme des valeurs expirées.
+    bool valide = true;
+
+    void garderMeilleur(const Durees& p_essai)
+    {
+        programmation = min(programmation, p_essai.programmation);
+        annulation = min(annulation, p_essai.annulation);
+        expiration = min(expiration, p_essai.expiration);
+    }
+};
+
+double nsDepuis(chrono::steady_clock::time_point p_debut, size_t p_nbOperations)
+{
+    const double duree = chrono::duration<double, nano>(chrono::steady_clock::now() - p_debut).count();
+    return duree / static_cast<double>(max<size_t>(1, p_nbOperations));
+}
+
+Durees mesurerRoue(const vector<uint64_t>& p_echeances, const vector<uint32_t>& p_annulees, uint64_t p_horizon)
+{
+    const size_t n = p_echeances.size();
+    Durees durees;
+    RoueTemporelle roue;
+    vector<RoueTemporelle::Minuterie> minuteries(n);
+
+    auto debut = chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i)
+        minuteries[i] = roue.programmer(p_echeances[i], i);
+    durees.programmation = nsDepuis(debut, n);
+
+    debut = chrono::steady_clock::now();
+    for (uint32_t i : p_annulees)
+        durees.valide = roue.annuler(minuteries[i]) && durees.valide;
+    durees.annulation = nsDepuis(debut, p_annulees.size());
+
+    debut = chrono::steady_clock::now();
+    durees.nbExpirees = roue.avancer(p_horizon, [&](uint64_t p_valeur, uint64_t p_echeance)
+        {
+            durees.somme += p_valeur;
+            durees.valide = durees.valide && p_echeance == roue.reqTick();
+        });
+    durees.expiration = nsDepuis(debut, durees.nbExpirees);
+    durees.valide = durees.valide && roue.taille() == 0;
+    return durees;
+}
+
+Durees mesurerTas(const vector<uint64_t>& p_echeances, const vector<uint32_t>& p_annulees)
+{
+    typedef pair<uint64_t, uint64_t> Entree;    // (échéance, valeur)
+    const size_t n = p_echeances.size();
+    Durees durees;
+    vector<Entree> entrees;
+    entrees.reserve(n);
+    priority_queue<Entree, vector<Entree>, greater<Entree>> tas(greater<Entree>(), move(entrees));
+    vector<uint8_t> annulees(n, 0);
+
+    auto debut = chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i)
+        tas.emplace(p_echeances[i], i);
+    durees.programmation = nsDepuis(debut, n);
+
+    debut = chrono::steady_clock::now();
+    for (uint32_t i : p_annulees)
+        annulees[i] = 1;
+    durees.annulation = nsDepuis(debut, p_annulees.size());
+
+    debut = chrono::steady_clock::now();
+    uint64_t precedente = 0;
+    while (!tas.empty())
+    {
+        const Entree entree = tas.top();
+        tas.pop();
+        durees.valide = durees.valide && entree.first >= precedente;
+        precedente = entree.first;
+        if (annulees[entree.second])
+            continue;
+        durees.somme += entree.second;
+        durees.nbExpirees++;
+    }
+    durees.expiration = nsDepuis(debut, durees.nbExpirees);
+    return durees;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    vector<long long> tailles;
+    for (int i = 1; i < argc; ++i)
+        tailles.push_back(atoll(argv[i]));
+    if (tailles.empty())
+        tailles = {1000000};
+    for (long long taille : tailles)
+        if (taille <= 0 || taille > 0xFFFFFFFFll)
+        {
+            cerr << "Utilisation : " << argv[0] << " [minuteries...]" << endl;
+            return 2;
+        }
+
+    bool toutValide = true;
+    try
+    {
+        cout << "Durées en ns par opération; annulation de la moitié des minuteries\n"
+             << "   minuteries  structure  programmer  annuler  expirer  bilan\n";
+        for (long long taille : tailles)
+        {
+            const size_t n = static_cast<size_t>(taille);
+            const uint64_t horizon = 4 * static_cast<uint64_t>(n);
+            mt19937_64 generateur(1);
+            uniform_int_distribution<uint64_t> echeance(1, horizon);
+            vector<uint64_t> echeances(n);
+            for (uint64_t& e : echeances)
+                e = echeance(generateur);
+            vector<uint32_t> annulees(n);
+            iota(annulees.begin(), annulees.end(), 0u);
+            shuffle(annulees.begin(), annulees.end(), generateur);
+            annulees.resize(n / 2);
+
+            Durees roue, tas;
+            for (int essai = 0; essai < NB_ESSAIS; ++essai)
+            {
+                const Durees essaiRoue = mesurerRoue(echeances, annulees, horizon);
+                const Durees essaiTas = mesurerTas(echeances, annulees);
+                if (essai == 0)
+                {
+                    roue = essaiRoue;
+                    tas = essaiTas;
+                }
+                roue.garderMeilleur(essaiRoue);
+                tas.garderMeilleur(essaiTas);
+                roue.valide = roue.valide && essaiRoue.valide;
+                tas.valide = tas.valide && essaiTas.valide;
+            }
+            const bool identique = roue.nbExpirees == n - annulees.size() && tas.nbExpirees == roue.nbExpirees
+                                   && tas.somme == roue.somme;
+            const bool valide = roue.valide && tas.valide && identique;
+            toutValide = toutValide && valide;
+            cout << setw(13) << n << "  " << setw(9) << left << "roue" << right << fixed << setprecision(1)
+                 << setw(12) << roue.programmation << setw(9) << roue.annulation << setw(9) << roue.expiration
+                 << "  " << (valide ? "ok" : "INVALIDE") << "\n"
+                 << setw(13) << "" << "  " << setw(9) << left << "tas" << right << setw(12) << tas.programmation
+                 << setw(9) << tas.annulation << setw(9) << tas.expiration << endl;
+        }
+    }
+    catch (const exception& e)
+    {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    return toutValide ? 0 : 1;
+}
@@ -6,7 +6,9 @@
  * \date Mai 2025
  */
 #include "Mission.h"
+#include <algorithm>
 #include <sstream>
+#include "Colis.h"
 #include "ContratException.h"
 
 using namespace std;
@@ -23,10 +25,30 @@ namespace microdrone
      * \pre p_droneId > 0
      * \pre p_colisId > 0
      */
-Mission::Mission(int p_droneId, int p_colisId):m_droneId(p_droneId), m_colisId(p_colisId), m_etat(MissionEtat::PLANIFIEE)
+Mission::Mission(int p_droneId, int p_colisId):m_id(0), m_droneId(p_droneId), m_colisIds(), m_nbColis(1), m_etat(MissionEtat::PLANIFIEE)
 {
     PRECONDITION(p_droneId > 0);
     PRECONDITION(p_colisId > 0);
+    m_colisIds[0] = p_colisId;
+    verifieInvariant();
+}
+
+    /**
+     * \brief Constructeur d'une mission livrant plusieurs colis en une sortie.
+     *
+     * \param[in] p_droneId Identifiant du drone affecté à la mission.
+     * \param[in] p_chargement Les colis emportés, dans l'ordre de livraison.
+     *
+     * \pre p_droneId > 0
+     * \pre !p_chargement.estVide()
+     */
+Mission::Mission(int p_droneId, const Chargement& p_chargement):m_id(0), m_droneId(p_droneId), m_colisIds(),
+    m_nbColis(p_chargement.taille()), m_etat(MissionEtat::PLANIFIEE)
+{
+    PRECONDITION(p_droneId > 0);
+    PRECONDITION(!p_chargement.estVide());
+    for (size_t i = 0; i < m_nbColis; ++i)
+        m_colisIds[i] = p_chargement[i].reqId();
     verifieInvariant();
 }
 
@@ -42,7 +64,10 @@ Mission::Mission(int p_droneId, int p_colisId):m_droneId(p_droneId), m_colisId(p
 string Mission::reqDescription() const
 {
     ostringstream oss;
-    oss << "[Drone #" << m_droneId << " → Colis #" << m_colisId << "] État: ";
+    oss << "[Drone #" << m_droneId << " → Colis #" << m_colisIds[0];
+    for (size_t i = 1; i < m_nbColis; ++i)
+        oss << ", #" << m_colisIds[i];
+    oss << "] État: ";
     switch (m_etat) {
         case MissionEtat::PLANIFIEE: oss << "PLANIFIÉE"; break;
         case MissionEtat::EN_COURS: oss << "EN COURS"; break;
@@ -59,7 +84,8 @@ string Mission::reqDescription() const
      */
 bool Mission::operator==(const Mission& p_mission) const
 {
-    return m_droneId == p_mission.m_droneId && m_colisId == p_mission.m_colisId;
+    return m_droneId == p_mission.m_droneId && m_nbColis == p_mission.m_nbColis
+           && equal(m_colisIds.begin(), m_colisIds.begin() + m_nbColis, p_mission.m_colisIds.begin());
 }
 
     /**
@@ -72,13 +98,47 @@ bool Mission::operator==(const Mission& p_mission) const
 }
 
     /**
-     * \brief Retourne l’identifiant du colis associé à la mission.
+     * \brief Retourne l’identifiant du premier colis associé à la mission.
      *
      * \return L’ID du colis.
      */
 int Mission::reqColisId() const
 {
-    return m_colisId;
+    return m_colisIds[0];
+}
+
+size_t Mission::reqNbColis() const
+{
+    return m_nbColis;
+}
+
+    /**
+     * \brief Retourne l’identifiant d'un des colis de la mission.
+     *
+     * \pre p_position < reqNbColis()
+     */
+int Mission::reqColisId(size_t p_position) const
+{
+    PRECONDITION(p_position < m_nbColis);
+    return m_colisIds[p_position];
+}
+
+MissionId Mission::reqId() const
+{
+    return m_id;
+}
+
+    /**
+     * \brief Attribue à la mission son identifiant, unique dans son gestionnaire.
+     *
+     * \param[in] p_id Le nouvel identifiant.
+     *
+     * \pre p_id > 0
+     */
+void Mission::definirId(MissionId p_id)
+{
+    PRECONDITION(p_id > 0);
+    m_id = p_id;
 }
 
     /**
@@ -110,7 +170,11 @@ void Mission::definirEtat(MissionEtat p_etat)
 void Mission::verifieInvariant() const
 {
     INVARIANT(m_droneId > 0);
-    INVARIANT(m_colisId > 0);
+    INVARIANT(m_nbColis > 0 && m_nbColis <= Chargement::CAPACITE);
+    for (size_t i = 0; i < m_nbColis; ++i)
+    {
+        INVARIANT(m_colisIds[i] > 0);
+    }
 }
 
 } // namespace microdrone
@@ -8,7 +8,11 @@
 #ifndef MISSION_H_DEJA_INCLU
 #define MISSION_H_DEJA_INCLU
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include "Chargement.h"
 
 namespace microdrone
 {
@@ -21,6 +25,9 @@ enum class MissionEtat
     TERMINEE     /*!< Mission terminée */
 };
 
+//! Identifiant d'une mission, attribué par le Gestionnaire à la planification.
+typedef std::uint64_t MissionId;
+
 /**
  * \brief Classe représentant une mission de livraison.
  */
@@ -31,6 +38,11 @@ public:
      * \brief Constructeur d'une mission.
      */
     Mission(int p_droneId, int p_colisId);
+
+    /**
+     * \brief Constructeur d'une mission livrant tout un chargement.
+     */
+    Mission(int p_droneId, const Chargement& p_chargement);
     
     /**
      * \brief Surcharge de l'opérateur de comparaison.
@@ -48,9 +60,31 @@ public:
     int reqDroneId() const;
 
     /**
-     * \brief Retourne l'ID du colis à livrer.
+     * \brief Retourne l'ID du premier colis à livrer.
+     */
+    int reqColisId() const;
+
+    /**
+     * \brief Retourne le nombre de colis livrés par la mission.
+     */
+    std::size_t reqNbColis() const;
+
+    /**
+     * \brief Retourne l'ID du colis de position p_position.
      */
-    int reqColisId() const;    /**
+    int reqColisId(std::size_t p_position) const;
+
+    /**
+     * \brief Retourne l'identifiant de la mission (0 : pas encore attribué).
+     */
+    MissionId reqId() const;
+
+    /**
+     * \brief Attribue l'identifiant de la mission.
+     */
+    void definirId(MissionId p_id);
+
+    /**
      * \brief Retourne l'état de la mission.
      */
     MissionEtat reqEtat() const;
@@ -66,8 +100,10 @@ public:
     void verifieInvariant() const;
 
 private:
+    MissionId m_id;     //!< ID de la mission (0 : pas encore attribué)
     int m_droneId;      //!< ID du drone assigné
-    int m_colisId;      //!< ID du colis à livrer
+    std::array<int, Chargement::CAPACITE> m_colisIds; //!< IDs des colis à livrer
+    std::size_t m_nbColis;                            //!< Nombre de colis
     MissionEtat m_etat; //!< État de la mission
 };
 
@@ -0,0 +1,247 @@
+/**
+ * \file NoyauEligibilite.cpp
+ * \brief Implantation du noyau vectoriel de recherche des drones éligibles.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Les versions SSE2 et AVX2 ne sont compilées que pour x86 avec GCC ou Clang,
+ * grâce à l'attribut target; ailleurs seule la version scalaire existe.
+ */
+#include "NoyauEligibilite.h"
+#include <algorithm>
+#include "ContratException.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MICRODRONE_NOYAU_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace microdrone
+{
+
+static_assert(static_cast<uint8_t>(DroneEtat::LIBRE) == 0,
+              "Le noyau suppose que LIBRE est codé par l'octet 0");
+
+namespace
+{
+
+const size_t BITS_PAR_MOT = 64;
+
+// Chaque jeu d'instructions fournit deux fonctions sur un bloc de 64 drones :
+// le masque des drones libres et le masque des charges suffisantes.
+typedef uint64_t (*FonctionLibres)(const DroneEtat*);
+typedef uint64_t (*FonctionCharges)(const double*, double);
+
+uint64_t libresScalaire(const DroneEtat* p_etats, size_t p_nb)
+{
+    uint64_t masque = 0;
+    for (size_t i = 0; i < p_nb; ++i)
+        masque |= uint64_t(p_etats[i] == DroneEtat::LIBRE) << i;
+    return masque;
+}
+
+uint64_t chargesScalaire(const double* p_chargesMax, size_t p_nb, double p_poids)
+{
+    uint64_t masque = 0;
+    for (size_t i = 0; i < p_nb; ++i)
+        masque |= uint64_t(p_chargesMax[i] >= p_poids) << i;
+    return masque;
+}
+
+uint64_t libresBlocScalaire(const DroneEtat* p_etats)
+{
+    return libresScalaire(p_etats, BITS_PAR_MOT);
+}
+
+uint64_t chargesBlocScalaire(const double* p_chargesMax, double p_poids)
+{
+    return chargesScalaire(p_chargesMax, BITS_PAR_MOT, p_poids);
+}
+
+#ifdef MICRODRONE_NOYAU_X86
+
+__attribute__((target("sse2")))
+uint64_t libresBlocSse2(const DroneEtat* p_etats)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i* octets = reinterpret_cast<const __m128i*>(p_etats);
+    uint64_t masque = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        __m128i etats = _mm_loadu_si128(octets + i);
+        uint64_t bits = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(etats, zero)));
+        masque |= bits << (16 * i);
+    }
+    return masque;
+}
+
+__attribute__((target("sse2")))
+uint64_t chargesBlocSse2(const double* p_chargesMax, double p_poids)
+{
+    const __m128d poids = _mm_set1_pd(p_poids);
+    uint64_t masque = 0;
+    for (size_t i = 0; i < BITS_PAR_MOT; i += 2)
+    {
+        __m128d charges = _mm_loadu_pd(p_chargesMax + i);
+        uint64_t bits = static_cast<unsigned>(_mm_movemask_pd(_mm_cmpge_pd(charges, poids)));
+        masque |= bits << i;
+    }
+    return masque;
+}
+
+__attribute__((target("avx2")))
+uint64_t libresBlocAvx2(const DroneEtat* p_etats)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i* octets = reinterpret_cast<const __m256i*>(p_etats);
+    uint64_t bas = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(octets), zero)));
+    uint64_t haut = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(octets + 1), zero)));
+    return bas | (haut << 32);
+}
+
+__attribute__((target("avx2")))
+uint64_t chargesBlocAvx2(const double* p_chargesMax, double p_poids)
+{
+    const __m256d poids = _mm256_set1_pd(p_poids);
+    uint64_t masque = 0;
+    for (size_t i = 0; i < BITS_PAR_MOT; i += 8)
+    {
+        __m256d a = _mm256_loadu_pd(p_chargesMax + i);
+        __m256d b = _mm256_loadu_pd(p_chargesMax + i + 4);
+        unsigned bitsA = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, poids, _CMP_GE_OQ)));
+        unsigned bitsB = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(b, poids, _CMP_GE_OQ)));
+        masque |= uint64_t(bitsA | (bitsB << 4)) << i;
+    }
+    return masque;
+}
+
+#endif // MICRODRONE_NOYAU_X86
+
+void choisirFonctions(JeuInstructions p_jeu, FonctionLibres& p_libres, FonctionCharges& p_charges)
+{
+    p_libres = libresBlocScalaire;
+    p_charges = chargesBlocScalaire;
+#ifdef MICRODRONE_NOYAU_X86
+    if (p_jeu == JeuInstructions::AVX2)
+    {
+        p_libres = libresBlocAvx2;
+        p_charges = chargesBlocAvx2;
+    }
+    else if (p_jeu == JeuInstructions::SSE2)
+    {
+        p_libres = libresBlocSse2;
+        p_charges = chargesBlocSse2;
+    }
+#else
+    (void)p_jeu;
+#endif
+}
+
+} // namespace
+
+    /**
+     * \brief Construit un noyau avec le meilleur jeu d'instructions du processeur.
+     */
+NoyauEligibilite::NoyauEligibilite():m_jeu(detecterJeuInstructions())
+{
+}
+
+    /**
+     * \brief Construit un noyau avec un jeu d'instructions imposé, par exemple
+     *        pour comparer les versions entre elles.
+     *
+     * \param[in] p_jeu Le jeu d'instructions voulu.
+     *
+     * \pre p_jeu est supporté par le processeur (voir detecterJeuInstructions).
+     */
+NoyauEligibilite::NoyauEligibilite(JeuInstructions p_jeu):m_jeu(p_jeu)
+{
+    PRECONDITION(p_jeu <= detecterJeuInstructions());
+}
+
+    /**
+     * \brief Détecte le meilleur jeu d'instructions utilisable.
+     *
+     * \return AVX2, SSE2 ou SCALAIRE.
+     */
+JeuInstructions NoyauEligibilite::detecterJeuInstructions()
+{
+#ifdef MICRODRONE_NOYAU_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return JeuInstructions::AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return JeuInstructions::SSE2;
+#endif
+    return JeuInstructions::SCALAIRE;
+}
+
+JeuInstructions NoyauEligibilite::reqJeuInstructions() const
+{
+    return m_jeu;
+}
+
+size_t NoyauEligibilite::nbMots(size_t p_nbDrones)
+{
+    return (p_nbDrones + BITS_PAR_MOT - 1) / BITS_PAR_MOT;
+}
+
+    /**
+     * \brief Calcule le masque des drones libres pouvant porter p_poids.
+     *
+     * \param[in] p_chargesMax Charges utiles, par rang.
+     * \param[in] p_etats États, par rang.
+     * \param[in] p_nbDrones Taille des deux tableaux.
+     * \param[in] p_poids Le poids à transporter.
+     * \param[out] p_masque Reçoit nbMots(p_nbDrones) mots.
+     */
+void NoyauEligibilite::calculer(const double* p_chargesMax, const DroneEtat* p_etats, size_t p_nbDrones,
+                                double p_poids, uint64_t* p_masque) const
+{
+    calculerLot(p_chargesMax, p_etats, p_nbDrones, &p_poids, 1, p_masque);
+}
+
+    /**
+     * \brief Calcule les masques de plusieurs poids en une seule passe sur la flotte.
+     *
+     * Les états d'un bloc de 64 drones ne sont lus qu'une fois pour tous les
+     * poids, et les charges restent en cache pendant les comparaisons.
+     *
+     * \param[in] p_chargesMax Charges utiles, par rang.
+     * \param[in] p_etats États, par rang.
+     * \param[in] p_nbDrones Taille des deux tableaux.
+     * \param[in] p_poids Les poids à transporter.
+     * \param[in] p_nbPoids Le nombre de poids.
+     * \param[out] p_masques Reçoit p_nbPoids masques consécutifs de nbMots(p_nbDrones) mots.
+     */
+void NoyauEligibilite::calculerLot(const double* p_chargesMax, const DroneEtat* p_etats, size_t p_nbDrones,
+                                   const double* p_poids, size_t p_nbPoids, uint64_t* p_masques) const
+{
+    FonctionLibres libresBloc;
+    FonctionCharges chargesBloc;
+    choisirFonctions(m_jeu, libresBloc, chargesBloc);
+
+    const size_t mots = nbMots(p_nbDrones);
+    for (size_t mot = 0; mot < mots; ++mot)
+    {
+        const size_t debut = mot * BITS_PAR_MOT;
+        const size_t nb = min(BITS_PAR_MOT, p_nbDrones - debut);
+        if (nb == BITS_PAR_MOT)
+        {
+            uint64_t libres = libresBloc(p_etats + debut);
+            for (size_t j = 0; j < p_nbPoids; ++j)
+                p_masques[j * mots + mot] = libres ? libres & chargesBloc(p_chargesMax + debut, p_poids[j]) : 0;
+        }
+        else
+        {
+            uint64_t libres = libresScalaire(p_etats + debut, nb);
+            for (size_t j = 0; j < p_nbPoids; ++j)
+                p_masques[j * mots + mot] = libres & chargesScalaire(p_chargesMax + debut, nb, p_poids[j]);
+        }
+    }
+}
+
+} // namespace microdrone
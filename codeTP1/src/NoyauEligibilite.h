@@ -0,0 +1,81 @@
+/**
+ * \file NoyauEligibilite.h
+ * \brief Déclaration du noyau vectoriel de recherche des drones éligibles.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef NOYAUELIGIBILITE_H_DEJA_INCLU
+#define NOYAUELIGIBILITE_H_DEJA_INCLU
+
+#include <cstddef>
+#include <cstdint>
+#include "Drone.h"
+
+namespace microdrone
+{
+
+//! Jeu d'instructions utilisé par le noyau.
+enum class JeuInstructions
+{
+    SCALAIRE,   /*!< Boucle simple, toujours disponible */
+    SSE2,       /*!< Deux drones par comparaison */
+    AVX2        /*!< Quatre drones par comparaison */
+};
+
+/**
+ * \class NoyauEligibilite
+ * \brief Calcule, pour un ou plusieurs poids, le masque des drones libres
+ *        assez puissants d'une flotte rangée en tableaux (FlotteSoA).
+ *
+ * Le bit i du mot i / 64 vaut 1 si le drone i est LIBRE et que sa charge
+ * utile est au moins égale au poids. Le jeu d'instructions est choisi à
+ * l'exécution selon le processeur; la version scalaire sert de repli.
+ */
+class NoyauEligibilite
+{
+public:
+    /**
+     * \brief Construit un noyau utilisant le meilleur jeu d'instructions disponible.
+     */
+    NoyauEligibilite();
+
+    /**
+     * \brief Construit un noyau utilisant un jeu d'instructions imposé.
+     */
+    explicit NoyauEligibilite(JeuInstructions p_jeu);
+
+    /**
+     * \brief Retourne le meilleur jeu d'instructions supporté par le processeur.
+     */
+    static JeuInstructions detecterJeuInstructions();
+
+    /**
+     * \brief Retourne le jeu d'instructions utilisé.
+     */
+    JeuInstructions reqJeuInstructions() const;
+
+    /**
+     * \brief Retourne le nombre de mots de 64 bits d'un masque pour p_nbDrones.
+     */
+    static std::size_t nbMots(std::size_t p_nbDrones);
+
+    /**
+     * \brief Calcule le masque des drones éligibles pour un poids.
+     */
+    void calculer(const double* p_chargesMax, const DroneEtat* p_etats, std::size_t p_nbDrones,
+                  double p_poids, std::uint64_t* p_masque) const;
+
+    /**
+     * \brief Calcule en une passe les masques de plusieurs poids.
+     */
+    void calculerLot(const double* p_chargesMax, const DroneEtat* p_etats, std::size_t p_nbDrones,
+                     const double* p_poids, std::size_t p_nbPoids, std::uint64_t* p_masques) const;
+
+private:
+    JeuInstructions m_jeu;  //!< Jeu d'instructions utilisé.
+};
+
+} // namespace microdrone
+
+#endif // NOYAUELIGIBILITE_H_DEJA_INCLU
@@ -0,0 +1,149 @@
+/**
+ * \file RoueTemporelle.cpp
+ * \brief Implantation de la roue temporelle hiérarchique des minuteries.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "RoueTemporelle.h"
+#include <algorithm>
+#include "ContratException.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+const RoueTemporelle::Minuterie RoueTemporelle::AUCUNE = ~RoueTemporelle::Minuterie(0);
+const uint32_t RoueTemporelle::NUL;
+
+RoueTemporelle::RoueTemporelle(uint64_t p_tick):m_tick(p_tick), m_taille(0), m_libres(NUL)
+{
+    m_cases.fill(NUL);
+}
+
+    /**
+     * \brief Programme une minuterie en O(1).
+     *
+     * \param[in] p_echeance Le tick d'expiration; une échéance passée expire au tick suivant.
+     * \param[in] p_valeur La valeur remise à l'expiration.
+     * \return La poignée permettant d'annuler la minuterie.
+     */
+RoueTemporelle::Minuterie RoueTemporelle::programmer(uint64_t p_echeance, uint64_t p_valeur)
+{
+    uint32_t noeud = m_libres;
+    if (noeud != NUL)
+    {
+        m_libres = m_noeuds[noeud].suivant;
+    }
+    else
+    {
+        PRECONDITION(m_noeuds.size() < NUL);
+        noeud = static_cast<uint32_t>(m_noeuds.size());
+        m_noeuds.push_back(Noeud{0, 0, NUL, NUL, 0, NUL});
+    }
+    m_noeuds[noeud].echeance = p_echeance;
+    m_noeuds[noeud].valeur = p_valeur;
+    inserer(noeud, m_tick + 1);
+    ++m_taille;
+    return (Minuterie(m_noeuds[noeud].generation) << 32) | noeud;
+}
+
+    /**
+     * \brief Annule une minuterie en O(1).
+     *
+     * \param[in] p_minuterie La poignée retournée par programmer.
+     * \return false si la minuterie a déjà expiré ou a déjà été annulée.
+     */
+bool RoueTemporelle::annuler(Minuterie p_minuterie)
+{
+    if (p_minuterie == AUCUNE)
+        return false;
+    uint32_t noeud = static_cast<uint32_t>(p_minuterie);
+    uint32_t generation = static_cast<uint32_t>(p_minuterie >> 32);
+    if (noeud >= m_noeuds.size() || m_noeuds[noeud].caseRoue == NUL || m_noeuds[noeud].generation != generation)
+        return false;
+    detacher(noeud);
+    liberer(noeud);
+    return true;
+}
+
+uint64_t RoueTemporelle::reqTick() const
+{
+    return m_tick;
+}
+
+size_t RoueTemporelle::taille() const
+{
+    return m_taille;
+}
+
+    /**
+     * \brief Range un nœud dans la case du niveau le plus fin contenant son échéance.
+     *
+     * \param[in] p_noeud Le nœud, détaché.
+     * \param[in] p_base Le premier tick qui n'a pas encore expiré.
+     */
+void RoueTemporelle::inserer(uint32_t p_noeud, uint64_t p_base)
+{
+    const uint64_t echeance = max(m_noeuds[p_noeud].echeance, p_base);
+    const uint64_t ecart = echeance - p_base;
+    uint32_t caseRoue = DEBORDEMENT;
+    for (size_t niveau = 0; niveau < NB_NIVEAUX; ++niveau)
+    {
+        if (ecart < (uint64_t(1) << (BITS_NIVEAU * (niveau + 1))))
+        {
+            caseRoue = static_cast<uint32_t>(niveau * NB_CASES + ((echeance >> (BITS_NIVEAU * niveau)) & (NB_CASES - 1)));
+            break;
+        }
+    }
+
+    Noeud& n = m_noeuds[p_noeud];
+    n.caseRoue = caseRoue;
+    n.precedent = NUL;
+    n.suivant = m_cases[caseRoue];
+    if (n.suivant != NUL)
+        m_noeuds[n.suivant].precedent = p_noeud;
+    m_cases[caseRoue] = p_noeud;
+}
+
+void RoueTemporelle::detacher(uint32_t p_noeud)
+{
+    Noeud& n = m_noeuds[p_noeud];
+    if (n.precedent != NUL)
+        m_noeuds[n.precedent].suivant = n.suivant;
+    else
+        m_cases[n.caseRoue] = n.suivant;
+    if (n.suivant != NUL)
+        m_noeuds[n.suivant].precedent = n.precedent;
+}
+
+    /**
+     * \brief Redistribue les minuteries d'une case dans les niveaux inférieurs.
+     */
+void RoueTemporelle::cascader(uint32_t p_case, uint64_t p_base)
+{
+    uint32_t noeud = m_cases[p_case];
+    m_cases[p_case] = NUL;
+    while (noeud != NUL)
+    {
+        uint32_t suivant = m_noeuds[noeud].suivant;
+        inserer(noeud, p_base);
+        noeud = suivant;
+    }
+}
+
+    /**
+     * \brief Rend un nœud détaché à la réserve; ses anciennes poignées deviennent invalides.
+     */
+void RoueTemporelle::liberer(uint32_t p_noeud)
+{
+    Noeud& n = m_noeuds[p_noeud];
+    n.caseRoue = NUL;
+    n.generation++;
+    n.suivant = m_libres;
+    m_libres = p_noeud;
+    --m_taille;
+}
+
+} // namespace microdrone
@@ -0,0 +1,155 @@
+/**
+ * \file RoueTemporelle.h
+ * \brief Déclaration de la roue temporelle hiérarchique des minuteries.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef ROUETEMPORELLE_H_DEJA_INCLU
+#define ROUETEMPORELLE_H_DEJA_INCLU
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace microdrone
+{
+
+/**
+ * \class RoueTemporelle
+ * \brief Minuteries à échéance entière (en ticks), programmées et annulées en O(1).
+ *
+ * Quatre niveaux de 256 cases couvrent 2^32 ticks : une minuterie est rangée
+ * dans le niveau le plus fin qui contient son échéance, puis redescend d'un
+ * niveau chaque fois que la roue du dessous fait un tour (cascade). Les
+ * échéances plus lointaines attendent dans une liste de débordement.
+ *
+ * Les minuteries sont des nœuds d'un tableau, chaînés par indices dans leur
+ * case; une poignée porte l'indice et une génération, ce qui rend sans effet
+ * l'annulation d'une minuterie déjà expirée.
+ */
+class RoueTemporelle
+{
+public:
+    typedef std::uint64_t Minuterie;     //!< Poignée d'une minuterie programmée.
+    static const Minuterie AUCUNE;       //!< Poignée ne désignant aucune minuterie.
+
+    /**
+     * \brief Construit une roue vide au tick p_tick.
+     */
+    explicit RoueTemporelle(std::uint64_t p_tick = 0);
+
+    /**
+     * \brief Programme une minuterie; p_valeur sera remise à son expiration.
+     */
+    Minuterie programmer(std::uint64_t p_echeance, std::uint64_t p_valeur);
+
+    /**
+     * \brief Annule une minuterie; retourne false si elle n'est plus programmée.
+     */
+    bool annuler(Minuterie p_minuterie);
+
+    /**
+     * \brief Avance jusqu'au tick p_jusqua en faisant expirer les minuteries échues.
+     */
+    template <typename Expiration>
+    std::size_t avancer(std::uint64_t p_jusqua, Expiration p_expirer, bool p_arreterApresExpiration = false);
+
+    /**
+     * \brief Retourne le tick courant : toutes les échéances antérieures ont expiré.
+     */
+    std::uint64_t reqTick() const;
+
+    /**
+     * \brief Retourne le nombre de minuteries programmées.
+     */
+    std::size_t taille() const;
+
+private:
+    static const std::size_t BITS_NIVEAU = 8;
+    static const std::size_t NB_CASES = 256;
+    static const std::size_t NB_NIVEAUX = 4;
+    static const std::uint32_t NUL = 0xFFFFFFFFu;
+    static const std::uint32_t DEBORDEMENT = NB_NIVEAUX * NB_CASES;
+
+    struct Noeud
+    {
+        std::uint64_t echeance;
+        std::uint64_t valeur;
+        std::uint32_t precedent;
+        std::uint32_t suivant;
+        std::uint32_t generation;
+        std::uint32_t caseRoue;     // NUL : nœud libre
+    };
+
+    void inserer(std::uint32_t p_noeud, std::uint64_t p_base);
+    void detacher(std::uint32_t p_noeud);
+    void cascader(std::uint32_t p_case, std::uint64_t p_base);
+    void liberer(std::uint32_t p_noeud);
+
+    std::uint64_t m_tick;                                       //!< Tick courant.
+    std::size_t m_taille;                                       //!< Minuteries programmées.
+    std::vector<Noeud> m_noeuds;                                //!< Réserve de nœuds.
+    std::uint32_t m_libres;                                     //!< Premier nœud libre.
+    std::array<std::uint32_t, NB_NIVEAUX * NB_CASES + 1> m_cases; //!< Tête de chaque case (+ débordement).
+};
+
+    /**
+     * \brief Avance la roue tick par tick jusqu'à p_jusqua.
+     *
+     * Chaque minuterie échue est retirée puis remise à p_expirer(valeur, échéance);
+     * p_expirer peut programmer ou annuler d'autres minuteries. Une roue vide
+     * saute directement à p_jusqua.
+     *
+     * \param[in] p_jusqua Le tick à atteindre.
+     * \param[in] p_expirer Fonction appelée pour chaque minuterie expirée.
+     * \param[in] p_arreterApresExpiration true pour s'arrêter après le premier
+     *            tick où des minuteries ont expiré, afin que l'appelant traite ce
+     *            tick avant de poursuivre.
+     * \return Le nombre de minuteries expirées.
+     */
+template <typename Expiration>
+std::size_t RoueTemporelle::avancer(std::uint64_t p_jusqua, Expiration p_expirer, bool p_arreterApresExpiration)
+{
+    std::size_t nbExpirees = 0;
+    while (m_tick < p_jusqua)
+    {
+        if (m_taille == 0)
+        {
+            m_tick = p_jusqua;
+            break;
+        }
+        const std::uint64_t tick = m_tick + 1;
+        // Les niveaux supérieurs descendent d'abord, puis le niveau 0 expire.
+        if ((tick & 0xFFFFFFFFu) == 0)
+            cascader(DEBORDEMENT, tick);
+        for (std::size_t niveau = NB_NIVEAUX - 1; niveau > 0; --niveau)
+        {
+            if ((tick & ((std::uint64_t(1) << (BITS_NIVEAU * niveau)) - 1)) == 0)
+                cascader(static_cast<std::uint32_t>(niveau * NB_CASES + ((tick >> (BITS_NIVEAU * niveau)) & (NB_CASES - 1))),
+                         tick);
+        }
+        m_tick = tick;
+
+        const std::uint32_t caseCourante = static_cast<std::uint32_t>(tick & (NB_CASES - 1));
+        const std::size_t avant = nbExpirees;
+        while (m_cases[caseCourante] != NUL)
+        {
+            std::uint32_t noeud = m_cases[caseCourante];
+            std::uint64_t valeur = m_noeuds[noeud].valeur;
+            std::uint64_t echeance = m_noeuds[noeud].echeance;
+            detacher(noeud);
+            liberer(noeud);
+            ++nbExpirees;
+            p_expirer(valeur, echeance);
+        }
+        if (p_arreterApresExpiration && nbExpirees != avant)
+            break;
+    }
+    return nbExpirees;
+}
+
+} // namespace microdrone
+
+#endif // ROUETEMPORELLE_H_DEJA_INCLU
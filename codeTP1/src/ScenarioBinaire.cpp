@@ -0,0 +1,344 @@
+/**
+ * \file ScenarioBinaire.cpp
+ * \brief Implantation du format binaire compact des scénarios.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "ScenarioBinaire.h"
+#include "ContratException.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+using namespace std;
+
+namespace microdrone
+{
+
+namespace
+{
+
+/**
+ * \brief Table de chaînes en construction : chaque chaîne distincte reçoit un indice.
+ */
+class TableChainesBinaire
+{
+public:
+    uint32_t ajouter(string_view p_chaine)
+    {
+        auto it = m_indices.find(p_chaine);
+        if (it != m_indices.end())
+            return it->second;
+        uint32_t indice = static_cast<uint32_t>(m_decalages.size());
+        m_decalages.push_back(static_cast<uint32_t>(m_octets.size()));
+        m_octets.append(p_chaine.data(), p_chaine.size());
+        m_indices.emplace(p_chaine, indice);
+        return indice;
+    }
+
+    const vector<uint32_t>& reqDecalages() const { return m_decalages; }
+    const string& reqOctets() const { return m_octets; }
+
+private:
+    unordered_map<string_view, uint32_t> m_indices; // Les vues pointent dans les données source.
+    vector<uint32_t> m_decalages;
+    string m_octets;
+};
+
+[[noreturn]] void signalerScenarioInvalide(const string& p_raison)
+{
+    throw runtime_error("Scénario binaire invalide : " + p_raison);
+}
+
+// Les enregistrements sont copiés octet pour octet : le format, petit-boutiste,
+// n'est lu et écrit que par un hôte petit-boutiste.
+#if defined(__BYTE_ORDER__)
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Le format binaire suppose un hôte petit-boutiste");
+#endif
+
+void verifierPetitBoutiste()
+{
+    const uint16_t un = 1;
+    unsigned char premier;
+    memcpy(&premier, &un, 1);
+    if (premier != 1)
+        throw runtime_error("Format binaire non supporté sur un hôte gros-boutiste");
+}
+
+} // namespace
+
+    /**
+     * \brief Indique si un contenu est un scénario binaire.
+     *
+     * \param[in] p_donnees Début du contenu.
+     * \param[in] p_taille Taille du contenu en octets.
+     * \return true si le contenu débute par SIGNATURE_SCENARIO.
+     */
+bool estScenarioBinaire(const char* p_donnees, size_t p_taille)
+{
+    return p_taille >= sizeof(SIGNATURE_SCENARIO)
+           && memcmp(p_donnees, SIGNATURE_SCENARIO, sizeof(SIGNATURE_SCENARIO)) == 0;
+}
+
+    /**
+     * \brief Écrit des enregistrements de scénario au format binaire.
+     *
+     * \param[in] p_nomFichier Le fichier de destination (écrasé s'il existe).
+     * \param[in] p_modeles Les modèles, dans l'ordre du scénario.
+     * \param[in] p_drones Les drones, dans l'ordre du scénario.
+     * \param[in] p_colis Les colis, dans l'ordre du scénario.
+     *
+     * \throw runtime_error si le fichier ne peut pas être écrit, si la table
+     *        des chaînes dépasse 4 Gio ou si l'hôte est gros-boutiste.
+     */
+void ecrireScenarioBinaire(const string& p_nomFichier,
+                           const vector<EnregistrementModele>& p_modeles,
+                           const vector<EnregistrementDrone>& p_drones,
+                           const vector<EnregistrementColis>& p_colis)
+{
+    verifierPetitBoutiste();
+    TableChainesBinaire chaines;
+
+    vector<DroneBinaire> drones;
+    drones.reserve(p_drones.size());
+    for (const EnregistrementDrone& drone : p_drones)
+        drones.push_back(DroneBinaire{drone.id, chaines.ajouter(drone.modele), drone.chargeMax});
+
+    vector<ColisBinaire> colis;
+    colis.reserve(p_colis.size());
+    for (const EnregistrementColis& c : p_colis)
+        colis.push_back(ColisBinaire{c.id, chaines.ajouter(c.destination), c.poids});
+
+    vector<ModeleBinaire> modeles;
+    modeles.reserve(p_modeles.size());
+    for (const EnregistrementModele& m : p_modeles)
+        modeles.push_back(ModeleBinaire{chaines.ajouter(m.nom), 0, m.chargeMax, m.vitesse, m.autonomie, m.rotation});
+
+    if (chaines.reqOctets().size() > UINT32_MAX)
+        throw runtime_error("Table des chaînes trop volumineuse pour le format binaire");
+    vector<uint32_t> decalages = chaines.reqDecalages();
+    decalages.push_back(static_cast<uint32_t>(chaines.reqOctets().size()));
+
+    EnTeteScenario entete{};
+    memcpy(entete.signature, SIGNATURE_SCENARIO, sizeof(SIGNATURE_SCENARIO));
+    entete.version = VERSION_SCENARIO;
+    entete.nbDrones = static_cast<uint32_t>(drones.size());
+    entete.nbColis = static_cast<uint32_t>(colis.size());
+    entete.nbChaines = static_cast<uint32_t>(decalages.size() - 1);
+    entete.nbModeles = static_cast<uint32_t>(modeles.size());
+    entete.tailleChaines = chaines.reqOctets().size();
+
+    ofstream fichier(p_nomFichier, ios::binary | ios::trunc);
+    if (!fichier)
+        throw runtime_error("Impossible d'écrire le fichier " + p_nomFichier);
+    fichier.write(reinterpret_cast<const char*>(&entete), sizeof(entete));
+    fichier.write(reinterpret_cast<const char*>(drones.data()), static_cast<streamsize>(drones.size() * sizeof(DroneBinaire)));
+    fichier.write(reinterpret_cast<const char*>(colis.data()), static_cast<streamsize>(colis.size() * sizeof(ColisBinaire)));
+    fichier.write(reinterpret_cast<const char*>(modeles.data()), static_cast<streamsize>(modeles.size() * sizeof(ModeleBinaire)));
+    fichier.write(reinterpret_cast<const char*>(decalages.data()), static_cast<streamsize>(decalages.size() * sizeof(uint32_t)));
+    fichier.write(chaines.reqOctets().data(), static_cast<streamsize>(chaines.reqOctets().size()));
+    if (!fichier)
+        throw runtime_error("Erreur d'écriture dans le fichier " + p_nomFichier);
+}
+
+    /**
+     * \brief Valide un scénario binaire sans copier ses enregistrements.
+     *
+     * \param[in] p_donnees Début du scénario binaire; doit survivre à la vue.
+     * \param[in] p_taille Taille du scénario en octets.
+     *
+     * \throw runtime_error si la signature, la version ou les tailles sont
+     *        incohérentes, si un enregistrement viole les règles du format texte
+     *        (identifiant, poids ou capacité non positifs, chaîne vide) ou si
+     *        l'hôte est gros-boutiste.
+     */
+VueScenarioBinaire::VueScenarioBinaire(const char* p_donnees, size_t p_taille):
+    m_donnees(p_donnees), m_entete(), m_debutColis(0), m_debutModeles(0)
+{
+    verifierPetitBoutiste();
+    if (p_taille < sizeof(EnTeteScenario) || !estScenarioBinaire(p_donnees, p_taille))
+        signalerScenarioInvalide("en-tête absent");
+    memcpy(&m_entete, p_donnees, sizeof(m_entete));
+    if (m_entete.version != 1 && m_entete.version != VERSION_SCENARIO)
+        signalerScenarioInvalide("version " + to_string(m_entete.version) + " non supportée");
+    if (m_entete.version == 1 && m_entete.nbModeles != 0)
+        signalerScenarioInvalide("champ réservé non nul en version 1");
+
+    m_debutColis = sizeof(EnTeteScenario) + size_t(m_entete.nbDrones) * sizeof(DroneBinaire);
+    m_debutModeles = m_debutColis + size_t(m_entete.nbColis) * sizeof(ColisBinaire);
+    const size_t debutDecalages = m_debutModeles + size_t(m_entete.nbModeles) * sizeof(ModeleBinaire);
+    const size_t debutChaines = debutDecalages + (size_t(m_entete.nbChaines) + 1) * sizeof(uint32_t);
+    if (m_entete.tailleChaines > p_taille || debutChaines + m_entete.tailleChaines != p_taille)
+        signalerScenarioInvalide("taille de fichier incohérente avec l'en-tête");
+
+    vector<uint32_t> decalages(size_t(m_entete.nbChaines) + 1);
+    memcpy(decalages.data(), p_donnees + debutDecalages, decalages.size() * sizeof(uint32_t));
+    if (decalages.back() != m_entete.tailleChaines)
+        signalerScenarioInvalide("table des chaînes tronquée");
+    m_chaines.resize(m_entete.nbChaines);
+    for (size_t i = 0; i < m_chaines.size(); ++i)
+    {
+        if (decalages[i] > decalages[i + 1])
+            signalerScenarioInvalide("décalage de chaîne invalide");
+        m_chaines[i] = string_view(p_donnees + debutChaines + decalages[i], decalages[i + 1] - decalages[i]);
+    }
+
+    for (size_t i = 0; i < reqNbModeles(); ++i)
+    {
+        const ModeleBinaire modele = reqModele(i);
+        if (modele.nom >= m_chaines.size() || m_chaines[modele.nom].empty())
+            signalerScenarioInvalide("nom de modèle inconnu à l'octet " + to_string(reqOctetModele(i)));
+        if (!(modele.chargeMax > 0.0) || !(modele.vitesse > 0.0) || !(modele.autonomie > 0.0)
+            || !(modele.rotation >= 0.0))
+            signalerScenarioInvalide("capacités de modèle invalides à l'octet " + to_string(reqOctetModele(i)));
+    }
+    for (size_t i = 0; i < reqNbDrones(); ++i)
+    {
+        const DroneBinaire drone = reqDrone(i);
+        if (drone.modele >= m_chaines.size() || m_chaines[drone.modele].empty())
+            signalerScenarioInvalide("modèle inconnu à l'octet " + to_string(reqOctetDrone(i)));
+        if (drone.id <= 0)
+            signalerScenarioInvalide("identifiant de drone invalide à l'octet " + to_string(reqOctetDrone(i)));
+        // Une charge nulle désigne celle du modèle, comme un DRONE texte sans charge.
+        if (drone.chargeMax != 0.0 && !(drone.chargeMax > 0.0))
+            signalerScenarioInvalide("charge utile invalide à l'octet " + to_string(reqOctetDrone(i)));
+    }
+    for (size_t i = 0; i < reqNbColis(); ++i)
+    {
+        const ColisBinaire colis = reqColis(i);
+        if (colis.destination >= m_chaines.size() || m_chaines[colis.destination].empty())
+            signalerScenarioInvalide("destination inconnue à l'octet " + to_string(reqOctetColis(i)));
+        if (colis.id <= 0)
+            signalerScenarioInvalide("identifiant de colis invalide à l'octet " + to_string(reqOctetColis(i)));
+        if (!(colis.poids > 0.0))
+            signalerScenarioInvalide("poids invalide à l'octet " + to_string(reqOctetColis(i)));
+    }
+}
+
+size_t VueScenarioBinaire::reqNbModeles() const
+{
+    return m_entete.nbModeles;
+}
+
+size_t VueScenarioBinaire::reqNbDrones() const
+{
+    return m_entete.nbDrones;
+}
+
+size_t VueScenarioBinaire::reqNbColis() const
+{
+    return m_entete.nbColis;
+}
+
+    /**
+     * \brief Relit un modèle; la copie évite tout accès non aligné.
+     *
+     * \pre p_rang < reqNbModeles()
+     */
+ModeleBinaire VueScenarioBinaire::reqModele(size_t p_rang) const
+{
+    PRECONDITION(p_rang < reqNbModeles());
+    ModeleBinaire modele;
+    memcpy(&modele, m_donnees + reqOctetModele(p_rang), sizeof(modele));
+    return modele;
+}
+
+    /**
+     * \brief Relit un drone; la copie évite tout accès non aligné.
+     *
+     * \pre p_rang < reqNbDrones()
+     */
+DroneBinaire VueScenarioBinaire::reqDrone(size_t p_rang) const
+{
+    PRECONDITION(p_rang < reqNbDrones());
+    DroneBinaire drone;
+    memcpy(&drone, m_donnees + reqOctetDrone(p_rang), sizeof(drone));
+    return drone;
+}
+
+    /**
+     * \brief Relit un colis; la copie évite tout accès non aligné.
+     *
+     * \pre p_rang < reqNbColis()
+     */
+ColisBinaire VueScenarioBinaire::reqColis(size_t p_rang) const
+{
+    PRECONDITION(p_rang < reqNbColis());
+    ColisBinaire colis;
+    memcpy(&colis, m_donnees + reqOctetColis(p_rang), sizeof(colis));
+    return colis;
+}
+
+size_t VueScenarioBinaire::reqOctetModele(size_t p_rang) const
+{
+    return m_debutModeles + p_rang * sizeof(ModeleBinaire);
+}
+
+size_t VueScenarioBinaire::reqOctetDrone(size_t p_rang) const
+{
+    return sizeof(EnTeteScenario) + p_rang * sizeof(DroneBinaire);
+}
+
+size_t VueScenarioBinaire::reqOctetColis(size_t p_rang) const
+{
+    return m_debutColis + p_rang * sizeof(ColisBinaire);
+}
+
+const vector<string_view>& VueScenarioBinaire::reqChaines() const
+{
+    return m_chaines;
+}
+
+    /**
+     * \brief Décode un scénario binaire sans copier les chaînes.
+     *
+     * Les modèles et destinations des enregistrements produits sont des vues
+     * sur p_donnees; le champ octet donne la position de l'enregistrement.
+     *
+     * \param[in] p_donnees Début du scénario binaire.
+     * \param[in] p_taille Taille du scénario en octets.
+     * \param[out] p_modeles Reçoit les modèles dans l'ordre du fichier.
+     * \param[out] p_drones Reçoit les drones dans l'ordre du fichier.
+     * \param[out] p_colis Reçoit les colis dans l'ordre du fichier.
+     *
+     * \throw runtime_error dans les cas de VueScenarioBinaire.
+     */
+void lireScenarioBinaire(const char* p_donnees, size_t p_taille,
+                         vector<EnregistrementModele>& p_modeles,
+                         vector<EnregistrementDrone>& p_drones,
+                         vector<EnregistrementColis>& p_colis)
+{
+    const VueScenarioBinaire vue(p_donnees, p_taille);
+    const vector<string_view>& chaines = vue.reqChaines();
+
+    p_modeles.clear();
+    p_modeles.reserve(vue.reqNbModeles());
+    for (size_t i = 0; i < vue.reqNbModeles(); ++i)
+    {
+        const ModeleBinaire modele = vue.reqModele(i);
+        p_modeles.push_back(EnregistrementModele{chaines[modele.nom], modele.chargeMax, modele.vitesse,
+                                                 modele.autonomie, modele.rotation, vue.reqOctetModele(i)});
+    }
+
+    p_drones.clear();
+    p_drones.reserve(vue.reqNbDrones());
+    for (size_t i = 0; i < vue.reqNbDrones(); ++i)
+    {
+        const DroneBinaire drone = vue.reqDrone(i);
+        p_drones.push_back(EnregistrementDrone{drone.id, chaines[drone.modele], drone.chargeMax, vue.reqOctetDrone(i)});
+    }
+
+    p_colis.clear();
+    p_colis.reserve(vue.reqNbColis());
+    for (size_t i = 0; i < vue.reqNbColis(); ++i)
+    {
+        const ColisBinaire colis = vue.reqColis(i);
+        p_colis.push_back(EnregistrementColis{colis.id, colis.poids, chaines[colis.destination],
+                                              vue.reqOctetColis(i)});
+    }
+}
+
+} // namespace microdrone
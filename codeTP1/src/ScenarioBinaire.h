@@ -0,0 +1,164 @@
+/**
+ * \file ScenarioBinaire.h
+ * \brief Déclaration du format binaire compact des scénarios.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Disposition du fichier (petit-boutiste, sans remplissage entre sections;
+ * lu et écrit seulement par un hôte petit-boutiste) :
+ * <pre>
+ * EnTeteScenario                          32 octets
+ * DroneBinaire[nbDrones]                  16 octets chacun
+ * ColisBinaire[nbColis]                   16 octets chacun
+ * ModeleBinaire[nbModeles]                40 octets chacun (version 2)
+ * uint32_t decalages[nbChaines + 1]       début de chaque chaîne dans la table
+ * char chaines[tailleChaines]             modèles et destinations, sans '\0'
+ * </pre>
+ * La version 1, sans modèles, est toujours lue.
+ * Chaque modèle et chaque destination distincts n'apparaissent qu'une fois
+ * dans la table des chaînes; les enregistrements y réfèrent par indice.
+ */
+#ifndef SCENARIOBINAIRE_H_DEJA_INCLU
+#define SCENARIOBINAIRE_H_DEJA_INCLU
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "LecteurScenario.h"
+
+namespace microdrone
+{
+
+const char SIGNATURE_SCENARIO[4] = {'F', 'D', 'R', 'N'}; //!< Signature d'un scénario binaire.
+const std::uint16_t VERSION_SCENARIO = 2;                 //!< Version courante du format.
+
+/**
+ * \brief En-tête fixe d'un scénario binaire.
+ */
+struct EnTeteScenario
+{
+    char signature[4];            //!< Toujours SIGNATURE_SCENARIO.
+    std::uint16_t version;        //!< Version du format.
+    std::uint16_t drapeaux;       //!< Réservé, à zéro.
+    std::uint32_t nbDrones;       //!< Nombre d'enregistrements drone.
+    std::uint32_t nbColis;        //!< Nombre d'enregistrements colis.
+    std::uint32_t nbChaines;      //!< Nombre de chaînes dans la table.
+    std::uint32_t nbModeles;      //!< Nombre d'enregistrements modèle (0 en version 1).
+    std::uint64_t tailleChaines;  //!< Taille de la table des chaînes en octets.
+};
+
+/**
+ * \brief Enregistrement drone compacté.
+ */
+struct DroneBinaire
+{
+    std::int32_t id;              //!< Identifiant du drone.
+    std::uint32_t modele;         //!< Indice du modèle dans la table des chaînes.
+    double chargeMax;             //!< Charge utile maximale en kg.
+};
+
+/**
+ * \brief Enregistrement colis compacté.
+ */
+struct ColisBinaire
+{
+    std::int32_t id;              //!< Identifiant du colis.
+    std::uint32_t destination;    //!< Indice de la destination dans la table des chaînes.
+    double poids;                 //!< Poids en kg.
+};
+
+/**
+ * \brief Enregistrement modèle compacté.
+ */
+struct ModeleBinaire
+{
+    std::uint32_t nom;            //!< Indice du nom dans la table des chaînes.
+    std::uint32_t reserve;        //!< Réservé, à zéro.
+    double chargeMax;             //!< Charge utile maximale en kg.
+    double vitesse;               //!< Vitesse de croisière en km/h.
+    double autonomie;             //!< Autonomie en minutes de vol.
+    double rotation;              //!< Temps au sol entre deux sorties, en minutes.
+};
+
+static_assert(sizeof(EnTeteScenario) == 32, "EnTeteScenario doit faire 32 octets");
+static_assert(sizeof(DroneBinaire) == 16, "DroneBinaire doit faire 16 octets");
+static_assert(sizeof(ColisBinaire) == 16, "ColisBinaire doit faire 16 octets");
+static_assert(sizeof(ModeleBinaire) == 40, "ModeleBinaire doit faire 40 octets");
+
+/**
+ * \class VueScenarioBinaire
+ * \brief Vue validée sur un scénario binaire, sans copie des enregistrements.
+ *
+ * Le constructeur vérifie l'en-tête, la table des chaînes et chaque
+ * enregistrement; les accesseurs relisent ensuite les enregistrements
+ * directement dans les données, qui doivent survivre à la vue.
+ */
+class VueScenarioBinaire
+{
+public:
+    /**
+     * \brief Valide le scénario binaire contenu dans p_donnees.
+     */
+    VueScenarioBinaire(const char* p_donnees, std::size_t p_taille);
+
+    /**
+     * \brief Retourne le nombre d'enregistrements de chaque section.
+     */
+    std::size_t reqNbModeles() const;
+    std::size_t reqNbDrones() const;
+    std::size_t reqNbColis() const;
+
+    /**
+     * \brief Retourne l'enregistrement de rang p_rang de chaque section.
+     */
+    ModeleBinaire reqModele(std::size_t p_rang) const;
+    DroneBinaire reqDrone(std::size_t p_rang) const;
+    ColisBinaire reqColis(std::size_t p_rang) const;
+
+    /**
+     * \brief Retourne la position en octets de l'enregistrement de rang p_rang.
+     */
+    std::size_t reqOctetModele(std::size_t p_rang) const;
+    std::size_t reqOctetDrone(std::size_t p_rang) const;
+    std::size_t reqOctetColis(std::size_t p_rang) const;
+
+    /**
+     * \brief Retourne la table des chaînes; les enregistrements y réfèrent par indice.
+     */
+    const std::vector<std::string_view>& reqChaines() const;
+
+private:
+    const char* m_donnees;                  //!< Début du scénario.
+    EnTeteScenario m_entete;                //!< En-tête validé.
+    std::size_t m_debutColis;               //!< Position du premier colis.
+    std::size_t m_debutModeles;             //!< Position du premier modèle.
+    std::vector<std::string_view> m_chaines; //!< Vues sur la table des chaînes.
+};
+
+/**
+ * \brief Indique si un contenu débute par la signature d'un scénario binaire.
+ */
+bool estScenarioBinaire(const char* p_donnees, std::size_t p_taille);
+
+/**
+ * \brief Écrit un scénario au format binaire.
+ */
+void ecrireScenarioBinaire(const std::string& p_nomFichier,
+                           const std::vector<EnregistrementModele>& p_modeles,
+                           const std::vector<EnregistrementDrone>& p_drones,
+                           const std::vector<EnregistrementColis>& p_colis);
+
+/**
+ * \brief Décode un scénario binaire projeté en mémoire.
+ */
+void lireScenarioBinaire(const char* p_donnees, std::size_t p_taille,
+                         std::vector<EnregistrementModele>& p_modeles,
+                         std::vector<EnregistrementDrone>& p_drones,
+                         std::vector<EnregistrementColis>& p_colis);
+
+} // namespace microdrone
+
+#endif // SCENARIOBINAIRE_H_DEJA_INCLU
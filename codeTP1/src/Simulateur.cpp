@@ -0,0 +1,325 @@
+/**
+ * \file Simulateur.cpp
+ * \brief Implantation du simulateur à événements discrets.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "Simulateur.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string>
+#include "ContratException.h"
+#include "TableChaines.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+namespace
+{
+const size_t NB_ZONES = 1000; // Destinations distinctes des arrivées générées.
+const double TICKS_PAR_MINUTE = 60.0; // Les retours sont programmés à la seconde près.
+}
+
+const double Simulateur::VITESSE_DEFAUT = 40.0;
+
+double BilanSimulation::reqLivraisonsParSeconde() const
+{
+    return dureeReelle > 0.0 ? static_cast<double>(nbLivraisons) / dureeReelle : 0.0;
+}
+
+    /**
+     * \brief Prépare la simulation d'un gestionnaire dont le scénario est chargé.
+     *
+     * Les colis déjà en attente sont planifiés au premier appel de executer.
+     *
+     * \param[in] p_gestionnaire Le gestionnaire, qui doit survivre au simulateur.
+     */
+Simulateur::Simulateur(Gestionnaire& p_gestionnaire):m_gestionnaire(p_gestionnaire), m_horloge(0.0),
+    m_distanceMoyenne(5.0), m_sequence(0), m_prochainIdColis(1), m_prochaineArrivee(0),
+    m_nbArriveesEnFile(0), m_arriveesTriees(true), m_nbLancementsEnFile(0),
+    m_nbColisABord(p_gestionnaire.m_flotte.taille(), 0)
+{
+    for (const Colis& colis : m_gestionnaire.m_tousLesColis)
+    {
+        m_prochainIdColis = max(m_prochainIdColis, colis.reqId() + 1);
+        transmettreDistance(colis.reqIdDestination());
+    }
+}
+
+    /**
+     * \brief Fixe la distance moyenne des destinations.
+     *
+     * Chaque destination est à une distance fixe, tirée de son nom, entre la
+     * moitié et une fois et demie cette moyenne. Les distances déjà transmises
+     * au gestionnaire sont mises à jour.
+     *
+     * \pre p_km > 0.0
+     */
+void Simulateur::definirDistanceMoyenne(double p_km)
+{
+    PRECONDITION(p_km > 0.0);
+    m_distanceMoyenne = p_km;
+    TableChaines& table = TableChaines::instance();
+    for (uint32_t destination : m_destinations)
+    {
+        const string_view nom = table.reqChaine(destination);
+        m_gestionnaire.definirDistanceDestination(nom, distanceDestination(nom));
+    }
+}
+
+    /**
+     * \brief Programme l'arrivée d'un colis dans la file du gestionnaire.
+     *
+     * \param[in] p_instant L'instant d'arrivée, en minutes (un instant passé vaut maintenant).
+     * \param[in] p_id L'identifiant du colis, inconnu du gestionnaire.
+     * \param[in] p_poids Le poids du colis.
+     * \param[in] p_destination La destination du colis.
+     */
+void Simulateur::programmerArrivee(double p_instant, int p_id, double p_poids, string_view p_destination)
+{
+    if (m_prochaineArrivee < m_arrivees.size() && p_instant < m_arrivees.back().instant)
+        m_arriveesTriees = false;
+    m_arrivees.push_back(ArriveeColis{p_instant, p_id, p_poids, TableChaines::instance().interner(p_destination)});
+    m_prochainIdColis = max(m_prochainIdColis, p_id + 1);
+}
+
+    /**
+     * \brief Programme des arrivées aléatoires à partir de l'instant courant.
+     *
+     * Les intervalles entre arrivées suivent une loi exponentielle; les poids
+     * sont uniformes et les destinations réparties sur NB_ZONES zones. Une même
+     * graine donne toujours les mêmes arrivées.
+     *
+     * \param[in] p_parHeure Nombre moyen de colis par heure.
+     * \param[in] p_duree Durée couverte, en minutes.
+     * \param[in] p_poidsMin Poids minimal d'un colis.
+     * \param[in] p_poidsMax Poids maximal d'un colis.
+     * \param[in] p_graine Graine du générateur.
+     *
+     * \pre p_parHeure > 0.0
+     * \pre 0.0 < p_poidsMin <= p_poidsMax
+     */
+void Simulateur::genererArrivees(double p_parHeure, double p_duree, double p_poidsMin, double p_poidsMax,
+                                 unsigned int p_graine)
+{
+    PRECONDITION(p_parHeure > 0.0);
+    PRECONDITION(p_poidsMin > 0.0 && p_poidsMin <= p_poidsMax);
+
+    vector<uint32_t> zones;
+    zones.reserve(NB_ZONES);
+    for (size_t i = 0; i < NB_ZONES; ++i)
+        zones.push_back(TableChaines::instance().interner("Zone " + to_string(i)));
+
+    mt19937_64 generateur(p_graine);
+    exponential_distribution<double> intervalle(p_parHeure / 60.0);
+    uniform_real_distribution<double> poids(p_poidsMin, p_poidsMax);
+    uniform_int_distribution<size_t> zone(0, NB_ZONES - 1);
+
+    const double fin = m_horloge + p_duree;
+    if (m_prochaineArrivee < m_arrivees.size())
+        m_arriveesTriees = false;
+    for (double instant = m_horloge + intervalle(generateur); instant < fin; instant += intervalle(generateur))
+        m_arrivees.push_back(ArriveeColis{instant, m_prochainIdColis++, poids(generateur), zones[zone(generateur)]});
+}
+
+    /**
+     * \brief Traite les événements jusqu'à l'instant courant + p_duree.
+     *
+     * \param[in] p_duree Le temps à simuler, en minutes.
+     * \return Les compteurs de cette exécution.
+     */
+BilanSimulation Simulateur::executer(double p_duree)
+{
+    const auto debut = chrono::steady_clock::now();
+    const double fin = m_horloge + p_duree;
+    BilanSimulation bilan;
+
+    if (!m_arriveesTriees)
+    {
+        stable_sort(m_arrivees.begin() + static_cast<ptrdiff_t>(m_prochaineArrivee), m_arrivees.end(),
+                    [](const ArriveeColis& a, const ArriveeColis& b) { return a.instant < b.instant; });
+        m_arriveesTriees = true;
+        m_nbArriveesEnFile = 0; // Un nouvel événement est programmé ci-dessous; les anciens deviennent inertes.
+    }
+    if (m_nbArriveesEnFile == 0)
+        programmerProchaineArrivee();
+
+    bool aPlanifier = true;
+    while (true)
+    {
+        // Planifier une seule fois par instant, après tous ses événements.
+        if (aPlanifier && (m_evenements.empty() || m_evenements.top().instant > m_horloge))
+        {
+            planifier();
+            aPlanifier = false;
+        }
+        // Les retours échus avant le prochain événement passent d'abord, un tick à la fois.
+        const double prochain = m_evenements.empty() ? fin : min(fin, m_evenements.top().instant);
+        const size_t nbRetours = m_gestionnaire.avancerEcheances(
+            static_cast<uint64_t>(prochain * TICKS_PAR_MINUTE), true);
+        if (nbRetours > 0)
+        {
+            m_horloge = static_cast<double>(m_gestionnaire.reqTickEcheances()) / TICKS_PAR_MINUTE;
+            bilan.nbEvenements += nbRetours;
+            aPlanifier = true;
+            continue;
+        }
+        if (m_evenements.empty() || m_evenements.top().instant > fin)
+            break;
+
+        Evenement evenement = m_evenements.top();
+        m_evenements.pop();
+        m_horloge = evenement.instant;
+        bilan.nbEvenements++;
+
+        switch (evenement.type)
+        {
+            case TypeEvenement::ARRIVEE_COLIS:
+                recevoirArrivees(bilan);
+                aPlanifier = true;
+                break;
+            case TypeEvenement::LANCEMENT:
+                lancer(bilan);
+                break;
+            case TypeEvenement::LIVRAISON:
+                bilan.nbLivraisons += m_nbColisABord[evenement.cible];
+                break;
+        }
+    }
+
+    bilan.dureeSimulee = p_duree;
+    m_horloge = fin;
+    bilan.dureeReelle = chrono::duration<double>(chrono::steady_clock::now() - debut).count();
+    return bilan;
+}
+
+double Simulateur::reqHorloge() const
+{
+    return m_horloge;
+}
+
+void Simulateur::programmer(double p_instant, TypeEvenement p_type, size_t p_cible)
+{
+    m_evenements.push(Evenement{p_instant, m_sequence++, p_type, p_cible});
+}
+
+    /**
+     * \brief Met la prochaine arrivée non traitée dans la file d'événements.
+     */
+void Simulateur::programmerProchaineArrivee()
+{
+    if (m_prochaineArrivee == m_arrivees.size())
+        return;
+    programmer(max(m_horloge, m_arrivees[m_prochaineArrivee].instant), TypeEvenement::ARRIVEE_COLIS,
+               m_prochaineArrivee);
+    m_nbArriveesEnFile++;
+}
+
+    /**
+     * \brief Ajoute au gestionnaire toutes les arrivées échues.
+     */
+void Simulateur::recevoirArrivees(BilanSimulation& p_bilan)
+{
+    if (m_nbArriveesEnFile > 0)
+        m_nbArriveesEnFile--;
+    TableChaines& table = TableChaines::instance();
+    while (m_prochaineArrivee < m_arrivees.size() && m_arrivees[m_prochaineArrivee].instant <= m_horloge)
+    {
+        const ArriveeColis& arrivee = m_arrivees[m_prochaineArrivee++];
+        transmettreDistance(arrivee.destination);
+        m_gestionnaire.ajouterColis(arrivee.id, arrivee.poids, table.reqChaine(arrivee.destination));
+        p_bilan.nbColisArrives++;
+    }
+    if (m_nbArriveesEnFile == 0)
+        programmerProchaineArrivee();
+}
+
+    /**
+     * \brief Planifie les colis en attente et programme un LANCEMENT par mission.
+     *
+     * Les missions planifiées par le gestionnaire lui-même (colis différés
+     * repris au retour d'un drone) reçoivent aussi leur LANCEMENT.
+     */
+void Simulateur::planifier()
+{
+    if (!m_gestionnaire.m_colisEnAttente.estVide())
+        m_gestionnaire.planifierMissions();
+    for (size_t i = m_nbLancementsEnFile; i < m_gestionnaire.m_missionsPlanifiees.taille(); ++i)
+        programmer(m_horloge, TypeEvenement::LANCEMENT, 0);
+    m_nbLancementsEnFile = m_gestionnaire.m_missionsPlanifiees.taille();
+}
+
+    /**
+     * \brief Lance la prochaine mission planifiée et programme sa livraison et son retour.
+     *
+     * L'aller dure distance / vitesse, la distance d'un chargement étant celle
+     * de sa destination la plus éloignée; le drone est prêt à repartir après
+     * le retour et la rotation au sol de son modèle. Le retour est une fin de
+     * mission programmée dans le gestionnaire, arrondie à la seconde suivante,
+     * et non un événement de la file. La planification a déjà écarté les
+     * destinations hors de l'autonomie du modèle.
+     */
+void Simulateur::lancer(BilanSimulation& p_bilan)
+{
+    m_nbLancementsEnFile--;
+    const Mission* mission = m_gestionnaire.lancerMission();
+    if (mission == nullptr)
+        return;
+    p_bilan.nbLancements++;
+
+    const size_t rang = m_gestionnaire.trouverRangDrone(mission->reqDroneId());
+    const CapaciteModele* capacite = m_gestionnaire.m_catalogue.trouver(m_gestionnaire.m_flotte.reqModeles()[rang]);
+    const double vitesse = capacite != nullptr ? capacite->vitesse : VITESSE_DEFAUT;
+    const double rotation = capacite != nullptr ? capacite->rotation : 0.0;
+
+    double distance = 0.0;
+    for (size_t i = 0; i < mission->reqNbColis(); ++i)
+    {
+        const Colis* colis = m_gestionnaire.trouverColisParId(mission->reqColisId(i));
+        if (colis != nullptr)
+            distance = max(distance, distanceDestination(colis->reqDestination()));
+    }
+    const double aller = distance / vitesse * 60.0;
+
+    m_nbColisABord[rang] = mission->reqNbColis();
+    programmer(m_horloge + aller, TypeEvenement::LIVRAISON, rang);
+    const double retour = m_horloge + 2.0 * aller + rotation;
+    m_gestionnaire.programmerFinMission(mission->reqDroneId(), static_cast<uint64_t>(ceil(retour * TICKS_PAR_MINUTE)));
+}
+
+    /**
+     * \brief Donne au gestionnaire la distance d'une destination, une seule fois par destination.
+     *
+     * \param[in] p_destination La destination, identifiant dans TableChaines.
+     */
+void Simulateur::transmettreDistance(uint32_t p_destination)
+{
+    if (p_destination >= m_distanceTransmise.size())
+        m_distanceTransmise.resize(p_destination + 1, false);
+    if (m_distanceTransmise[p_destination])
+        return;
+    m_distanceTransmise[p_destination] = true;
+    m_destinations.push_back(p_destination);
+    const string_view nom = TableChaines::instance().reqChaine(p_destination);
+    m_gestionnaire.definirDistanceDestination(nom, distanceDestination(nom));
+}
+
+    /**
+     * \brief Retourne la distance d'une destination, stable d'une exécution à l'autre.
+     */
+double Simulateur::distanceDestination(string_view p_destination) const
+{
+    uint64_t h = hash<string_view>()(p_destination);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return m_distanceMoyenne * (0.5 + static_cast<double>(h % 1024) / 1023.0);
+}
+
+} // namespace microdrone
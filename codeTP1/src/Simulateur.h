@@ -0,0 +1,154 @@
+/**
+ * \file Simulateur.h
+ * \brief Déclaration du simulateur à événements discrets.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef SIMULATEUR_H_DEJA_INCLU
+#define SIMULATEUR_H_DEJA_INCLU
+
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <string_view>
+#include <vector>
+#include "Gestionnaire.h"
+
+namespace microdrone
+{
+
+//! Nature d'un événement de la simulation.
+enum class TypeEvenement : std::uint8_t
+{
+    ARRIVEE_COLIS,  /*!< Un colis entre dans la file d'attente */
+    LANCEMENT,      /*!< La prochaine mission planifiée décolle */
+    LIVRAISON       /*!< Un drone dépose son chargement */
+};
+
+/**
+ * \brief Événement daté de la simulation.
+ */
+struct Evenement
+{
+    double instant;             //!< Instant simulé, en minutes.
+    std::uint64_t sequence;     //!< Ordre de création, départage les instants égaux.
+    TypeEvenement type;         //!< Nature de l'événement.
+    std::size_t cible;          //!< Rang de l'arrivée ou rang du drone dans la flotte.
+};
+
+/**
+ * \brief Résultat d'un appel à Simulateur::executer.
+ */
+struct BilanSimulation
+{
+    double dureeSimulee = 0.0;          //!< Temps simulé, en minutes.
+    double dureeReelle = 0.0;           //!< Temps d'exécution, en secondes.
+    std::size_t nbEvenements = 0;       //!< Événements traités.
+    std::size_t nbColisArrives = 0;     //!< Colis ajoutés à la file.
+    std::size_t nbLancements = 0;       //!< Missions lancées.
+    std::size_t nbLivraisons = 0;       //!< Colis livrés.
+
+    /**
+     * \brief Retourne le nombre de livraisons simulées par seconde réelle.
+     */
+    double reqLivraisonsParSeconde() const;
+};
+
+/**
+ * \class Simulateur
+ * \brief Rejoue l'exploitation d'un Gestionnaire sur une horloge virtuelle.
+ *
+ * Les événements sont tirés d'une file de priorité par instant croissant;
+ * à instant égal, dans leur ordre de création. Après chaque instant où un
+ * colis arrive ou un drone revient, le gestionnaire planifie ses missions et
+ * chacune donne un LANCEMENT. La durée d'un vol dépend de la vitesse du
+ * modèle (CatalogueModeles) et d'une distance propre à chaque destination,
+ * transmise au gestionnaire : sa planification ne confie un colis qu'à un
+ * drone dont l'autonomie couvre l'aller-retour.
+ *
+ * Les arrivées sont gardées triées à part : seule la prochaine est dans la
+ * file. Le retour d'un drone (rotation comprise) n'est pas un événement de la
+ * file mais une fin de mission programmée dans la roue temporelle du
+ * gestionnaire; la file ne contient donc qu'environ un événement par drone en vol.
+ */
+class Simulateur
+{
+public:
+    static const double VITESSE_DEFAUT;  //!< Vitesse (km/h) d'un modèle absent du catalogue.
+
+    /**
+     * \brief Prépare une simulation du gestionnaire, à l'instant 0.
+     */
+    explicit Simulateur(Gestionnaire& p_gestionnaire);
+
+    /**
+     * \brief Fixe la distance moyenne d'une destination, en km.
+     */
+    void definirDistanceMoyenne(double p_km);
+
+    /**
+     * \brief Programme l'arrivée d'un colis.
+     */
+    void programmerArrivee(double p_instant, int p_id, double p_poids, std::string_view p_destination);
+
+    /**
+     * \brief Programme des arrivées aléatoires (processus de Poisson).
+     */
+    void genererArrivees(double p_parHeure, double p_duree, double p_poidsMin, double p_poidsMax,
+                         unsigned int p_graine);
+
+    /**
+     * \brief Fait avancer la simulation de p_duree minutes.
+     */
+    BilanSimulation executer(double p_duree);
+
+    /**
+     * \brief Retourne l'instant simulé courant, en minutes.
+     */
+    double reqHorloge() const;
+
+private:
+    struct ArriveeColis
+    {
+        double instant;
+        int id;
+        double poids;
+        std::uint32_t destination;
+    };
+
+    struct PlusTardif
+    {
+        bool operator()(const Evenement& p_a, const Evenement& p_b) const
+        {
+            return p_a.instant > p_b.instant || (p_a.instant == p_b.instant && p_a.sequence > p_b.sequence);
+        }
+    };
+
+    void programmer(double p_instant, TypeEvenement p_type, std::size_t p_cible);
+    void programmerProchaineArrivee();
+    void recevoirArrivees(BilanSimulation& p_bilan);
+    void planifier();
+    void lancer(BilanSimulation& p_bilan);
+    void transmettreDistance(std::uint32_t p_destination);
+    double distanceDestination(std::string_view p_destination) const;
+
+    Gestionnaire& m_gestionnaire;                   //!< Gestionnaire simulé.
+    double m_horloge;                               //!< Instant simulé courant, en minutes.
+    double m_distanceMoyenne;                       //!< Distance moyenne d'une destination, en km.
+    std::uint64_t m_sequence;                       //!< Prochain numéro de séquence.
+    int m_prochainIdColis;                          //!< Identifiant du prochain colis généré.
+    std::priority_queue<Evenement, std::vector<Evenement>, PlusTardif> m_evenements; //!< Événements à venir.
+    std::vector<ArriveeColis> m_arrivees;           //!< Arrivées programmées.
+    std::size_t m_prochaineArrivee;                 //!< Rang de la prochaine arrivée à traiter.
+    std::size_t m_nbArriveesEnFile;                 //!< Événements ARRIVEE_COLIS dans m_evenements.
+    bool m_arriveesTriees;                          //!< m_arrivees est triée à partir de m_prochaineArrivee.
+    std::size_t m_nbLancementsEnFile;               //!< Événements LANCEMENT dans m_evenements.
+    std::vector<std::size_t> m_nbColisABord;        //!< Colis du vol en cours, par rang de drone.
+    std::vector<std::uint32_t> m_destinations;      //!< Destinations dont la distance est transmise.
+    std::vector<bool> m_distanceTransmise;          //!< Destination (identifiant dans TableChaines) → distance transmise.
+};
+
+} // namespace microdrone
+
+#endif // SIMULATEUR_H_DEJA_INCLU
@@ -0,0 +1,74 @@
+/**
+ * \file SimulerScenario.cpp
+ * \brief Outil de simulation accélérée d'une période d'exploitation.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : SimulerScenario <scenario> [heures] [colis_par_heure] [graine]
+ *
+ * Le scénario fournit la flotte et les colis présents à l'instant 0; des
+ * arrivées aléatoires s'y ajoutent si colis_par_heure est positif.
+ * Compilé avec FLOTTE_TRACAGE, l'outil écrit aussi SimulerScenario.trace.json.
+ */
+#include "Gestionnaire.h"
+#include "Simulateur.h"
+#include "Traceur.h"
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+using namespace microdrone;
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 5)
+    {
+        cerr << "Utilisation : " << argv[0] << " <scenario> [heures] [colis_par_heure] [graine]" << endl;
+        return 2;
+    }
+    const double heures = argc > 2 ? atof(argv[2]) : 24.0;
+    const double parHeure = argc > 3 ? atof(argv[3]) : 0.0;
+    const unsigned int graine = argc > 4 ? static_cast<unsigned int>(atoi(argv[4])) : 1u;
+
+    try
+    {
+        Gestionnaire gestionnaire;
+        gestionnaire.definirNbFilsChargement(0);
+        gestionnaire.chargerScenario(argv[1]);
+
+        // Les messages et notifications de chaque mission ralentiraient la simulation.
+        ostream muet(nullptr);
+        gestionnaire.definirSortie(muet);
+        gestionnaire.definirNotificationsActives(false);
+
+        Simulateur simulateur(gestionnaire);
+        if (parHeure > 0.0)
+            simulateur.genererArrivees(parHeure, heures * 60.0, 0.1, 2.0, graine);
+        BilanSimulation bilan = simulateur.executer(heures * 60.0);
+
+        gestionnaire.definirSortie(cout);
+        cout << fixed << setprecision(1)
+             << "Durée simulée : " << bilan.dureeSimulee / 60.0 << " h\n"
+             << "Colis arrivés : " << bilan.nbColisArrives << "\n"
+             << "Missions lancées : " << bilan.nbLancements << "\n"
+             << "Colis livrés : " << bilan.nbLivraisons << "\n"
+             << "Événements traités : " << bilan.nbEvenements << "\n"
+             << setprecision(3) << "Durée réelle : " << bilan.dureeReelle << " s\n"
+             << setprecision(0) << "Livraisons simulées par seconde : " << bilan.reqLivraisonsParSeconde() << "\n";
+        cout << gestionnaire.reqStatistiques() << endl;
+#if defined(FLOTTE_TRACAGE)
+        Traceur::exporter("SimulerScenario.trace.json");
+        cout << "Trace : SimulerScenario.trace.json (" << Traceur::reqNbEvenements() << " événements, "
+             << Traceur::reqNbEvenementsPerdus() << " perdus)" << endl;
+#endif
+    }
+    catch (const exception& e)
+    {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
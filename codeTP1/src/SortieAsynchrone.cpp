@@ -0,0 +1,164 @@
+/**
+ * \file SortieAsynchrone.cpp
+ * \brief Implantation de la sortie asynchrone des notifications.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "SortieAsynchrone.h"
+#include <chrono>
+#include <stdexcept>
+
+using namespace std;
+
+namespace microdrone
+{
+
+const size_t SortieAsynchrone::CAPACITE_DEFAUT = 65536;
+
+namespace
+{
+const size_t TAILLE_LOT = 1024;         // Notifications écrites par vidage du flux, au plus.
+const unsigned int CEDER_AVANT_PAUSE = 64; // Tours à vide avant que le fil d'écriture ne dorme.
+const chrono::microseconds PAUSE(200);
+}
+
+    /**
+     * \brief Démarre le fil d'écriture vers p_flux.
+     *
+     * \param[in] p_flux Le flux de destination, par exemple std::cout.
+     * \param[in] p_capacite Le nombre maximal de notifications en attente.
+     *
+     * \pre p_capacite est une puissance de deux non nulle.
+     */
+SortieAsynchrone::SortieAsynchrone(ostream& p_flux, size_t p_capacite):m_flux(p_flux), m_file(p_capacite),
+    m_nbPubliees(0), m_nbPerdues(0), m_nbEcrites(0), m_arret(false)
+{
+    demarrer();
+}
+
+    /**
+     * \brief Démarre le fil d'écriture vers un fichier.
+     *
+     * \param[in] p_nomFichier Le fichier de destination.
+     * \param[in] p_capacite Le nombre maximal de notifications en attente.
+     *
+     * \pre p_capacite est une puissance de deux non nulle.
+     *
+     * \throw runtime_error si le fichier ne peut pas être ouvert.
+     */
+SortieAsynchrone::SortieAsynchrone(const string& p_nomFichier, size_t p_capacite):m_fichier(p_nomFichier),
+    m_flux(m_fichier), m_file(p_capacite), m_nbPubliees(0), m_nbPerdues(0), m_nbEcrites(0), m_arret(false)
+{
+    if (!m_fichier)
+        throw runtime_error("Impossible d'ouvrir le fichier " + p_nomFichier);
+    demarrer();
+}
+
+SortieAsynchrone::~SortieAsynchrone()
+{
+    arreter();
+}
+
+    /**
+     * \brief Confie une notification au fil d'écriture, en O(1) et sans verrou.
+     *
+     * \param[in] p_notification La notification.
+     * \return false si la file était pleine : la notification est perdue et comptée.
+     */
+bool SortieAsynchrone::publier(const Notification& p_notification)
+{
+    if (!m_file.ajouter(p_notification))
+    {
+        m_nbPerdues.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+    m_nbPubliees++;
+    return true;
+}
+
+    /**
+     * \brief Attend que toutes les notifications publiées jusqu'ici soient écrites
+     *        et le flux vidé. À appeler depuis le fil qui publie.
+     */
+void SortieAsynchrone::vider()
+{
+    while (m_fil.joinable() && m_nbEcrites.load(memory_order_acquire) < m_nbPubliees)
+        this_thread::sleep_for(PAUSE);
+}
+
+    /**
+     * \brief Arrête le fil d'écriture après qu'il a écrit toutes les notifications publiées.
+     *
+     * Sans effet si la sortie est déjà arrêtée; les publications suivantes
+     * restent dans la file sans être écrites.
+     */
+void SortieAsynchrone::arreter()
+{
+    if (!m_fil.joinable())
+        return;
+    m_arret.store(true, memory_order_release);
+    m_fil.join();
+    m_flux.flush();
+}
+
+uint64_t SortieAsynchrone::reqNbPerdues() const
+{
+    return m_nbPerdues.load(memory_order_relaxed);
+}
+
+uint64_t SortieAsynchrone::reqNbEcrites() const
+{
+    return m_nbEcrites.load(memory_order_acquire);
+}
+
+void SortieAsynchrone::demarrer()
+{
+    m_fil = thread(&SortieAsynchrone::ecrire, this);
+}
+
+    /**
+     * \brief Boucle du fil d'écriture : lots de lignes, un vidage par lot.
+     *
+     * La demande d'arrêt est lue avant de vider la file, de sorte que tout ce
+     * qui a été publié avant arreter() est écrit.
+     */
+void SortieAsynchrone::ecrire()
+{
+    string lot;
+    Notification notification;
+    unsigned int toursAVide = 0;
+    while (true)
+    {
+        const bool arret = m_arret.load(memory_order_acquire);
+        size_t nb = 0;
+        lot.clear();
+        while (nb < TAILLE_LOT && m_file.retirer(notification))
+        {
+            lot += notification.formater();
+            lot += '\n';
+            nb++;
+        }
+        if (nb > 0)
+        {
+            m_flux.write(lot.data(), static_cast<streamsize>(lot.size()));
+            m_flux.flush();
+            m_nbEcrites.fetch_add(nb, memory_order_release);
+            toursAVide = 0;
+        }
+        else if (arret)
+        {
+            break;
+        }
+        else if (++toursAVide < CEDER_AVANT_PAUSE)
+        {
+            this_thread::yield();
+        }
+        else
+        {
+            this_thread::sleep_for(PAUSE);
+        }
+    }
+}
+
+} // namespace microdrone
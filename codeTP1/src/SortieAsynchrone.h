@@ -0,0 +1,99 @@
+/**
+ * \file SortieAsynchrone.h
+ * \brief Déclaration de la sortie asynchrone des notifications.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef SORTIEASYNCHRONE_H_DEJA_INCLU
+#define SORTIEASYNCHRONE_H_DEJA_INCLU
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <thread>
+#include "FileSpsc.h"
+#include "JournalNotifications.h"
+
+namespace microdrone
+{
+
+/**
+ * \class SortieAsynchrone
+ * \brief Écrit les notifications sur un flux depuis un fil d'arrière-plan.
+ *
+ * Le fil qui publie (le planificateur) ne fait que copier la notification
+ * dans une FileSpsc : ni formatage, ni entrée-sortie, ni verrou. Le fil
+ * d'écriture retire les notifications par lots, compose leurs lignes et les
+ * écrit d'un bloc, avec un seul vidage du flux par lot. Si la file est
+ * pleine, la notification est abandonnée et comptée. Un seul fil doit
+ * publier.
+ */
+class SortieAsynchrone
+{
+public:
+    static const std::size_t CAPACITE_DEFAUT;   //!< Notifications en attente d'écriture, au plus.
+
+    /**
+     * \brief Démarre l'écriture vers un flux, qui doit survivre à la sortie.
+     */
+    explicit SortieAsynchrone(std::ostream& p_flux, std::size_t p_capacite = CAPACITE_DEFAUT);
+
+    /**
+     * \brief Démarre l'écriture vers un fichier, remplacé s'il existe.
+     */
+    explicit SortieAsynchrone(const std::string& p_nomFichier, std::size_t p_capacite = CAPACITE_DEFAUT);
+
+    /**
+     * \brief Écrit les notifications restantes puis arrête le fil d'écriture.
+     */
+    ~SortieAsynchrone();
+
+    SortieAsynchrone(const SortieAsynchrone&) = delete;
+    SortieAsynchrone& operator=(const SortieAsynchrone&) = delete;
+
+    /**
+     * \brief Confie une notification au fil d'écriture, sans attendre.
+     */
+    bool publier(const Notification& p_notification);
+
+    /**
+     * \brief Attend que toutes les notifications publiées soient écrites.
+     */
+    void vider();
+
+    /**
+     * \brief Écrit les notifications restantes et arrête le fil d'écriture.
+     */
+    void arreter();
+
+    /**
+     * \brief Retourne le nombre de notifications abandonnées, file pleine.
+     */
+    std::uint64_t reqNbPerdues() const;
+
+    /**
+     * \brief Retourne le nombre de notifications écrites.
+     */
+    std::uint64_t reqNbEcrites() const;
+
+private:
+    void demarrer();
+    void ecrire();
+
+    std::ofstream m_fichier;                    //!< Fichier ouvert par la sortie, le cas échéant.
+    std::ostream& m_flux;                       //!< Destination des lignes.
+    FileSpsc<Notification> m_file;              //!< Notifications publiées, pas encore écrites.
+    std::uint64_t m_nbPubliees;                 //!< Notifications acceptées (fil qui publie).
+    std::atomic<std::uint64_t> m_nbPerdues;     //!< Notifications abandonnées.
+    std::atomic<std::uint64_t> m_nbEcrites;     //!< Notifications écrites et vidées (fil d'écriture).
+    std::atomic<bool> m_arret;                  //!< Demande d'arrêt du fil d'écriture.
+    std::thread m_fil;                          //!< Fil d'écriture.
+};
+
+} // namespace microdrone
+
+#endif // SORTIEASYNCHRONE_H_DEJA_INCLU
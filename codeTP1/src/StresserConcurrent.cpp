@@ -0,0 +1,162 @@
+/**
+ * \file StresserConcurrent.cpp
+ * \brief Essai de charge et mesure du débit de GestionnaireConcurrent selon le nombre de fils.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Utilisation : StresserConcurrent [drones] [colis] [fils_max] [graine]
+ *
+ * Pour 1, 2, 4, ... jusqu'à fils_max (16 par défaut) fils, chaque fil reçoit
+ * sa part des colis, planifie et termine les missions de sa part des drones,
+ * par tours de taille fixe, jusqu'à ce que tous les colis soient livrés ou
+ * refusés. Une partie des colis est plus lourde que tout drone. L'outil vérifie ensuite que chaque
+ * colis a été livré ou refusé et que tous les drones sont libres, et écrit
+ * une ligne par nombre de fils. Le code de retour est 1 si une vérification
+ * échoue. Compilé avec FLOTTE_SANITISEUR_FILS, il sert d'essai sous
+ * ThreadSanitizer.
+ */
+#include "GestionnaireConcurrent.h"
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace microdrone;
+
+namespace
+{
+const size_t TAILLE_LOT = 256;  // Colis reçus et planifiés par tour d'un fil.
+const size_t TAILLE_BALAYAGE = 2 * TAILLE_LOT;  // Drones examinés par tour pour les fins de mission.
+
+struct Mesure
+{
+    double duree = 0.0;     // Secondes, de la première réception au dernier colis traité.
+    size_t nbLivres = 0;
+    size_t nbRefuses = 0;
+    bool bilanExact = true;
+};
+
+Mesure mesurer(size_t p_nbFils, int p_nbDrones, const vector<double>& p_poids)
+{
+    const double charges[] = {0.5, 1.0, 2.0};
+    vector<DroneAtomique> drones;
+    drones.reserve(p_nbDrones);
+    for (int id = 1; id <= p_nbDrones; ++id)
+        drones.emplace_back(id, charges[id % 3]);
+
+    const size_t nbColis = p_poids.size();
+    size_t capacite = GestionnaireConcurrent::CAPACITE_DEFAUT;
+    while (capacite < nbColis)
+        capacite <<= 1;
+    GestionnaireConcurrent gestionnaire(capacite);
+    gestionnaire.chargerFlotte(move(drones));
+
+    vector<thread> fils;
+    const auto debut = chrono::steady_clock::now();
+    for (size_t f = 0; f < p_nbFils; ++f)
+    {
+        fils.emplace_back([&, f]()
+                          {
+                              size_t prochain = f + 1;
+                              size_t curseur = f;     // Rang du prochain drone de la part du fil.
+                              while (true)
+                              {
+                                  for (size_t k = 0; k < TAILLE_LOT && prochain <= nbColis; ++k)
+                                  {
+                                      if (!gestionnaire.soumettreColis(static_cast<int>(prochain), p_poids[prochain - 1]))
+                                          break;
+                                      prochain += p_nbFils;
+                                  }
+                                  const size_t nbLances = gestionnaire.planifierMissions(TAILLE_LOT);
+                                  size_t nbTermines = 0;
+                                  for (size_t k = 0; k < TAILLE_BALAYAGE; ++k)
+                                  {
+                                      nbTermines += gestionnaire.terminerMission(static_cast<int>(curseur + 1));
+                                      curseur += p_nbFils;
+                                      if (curseur >= static_cast<size_t>(p_nbDrones))
+                                          curseur = f;
+                                  }
+
+                                  const StatistiquesFlotte compteurs = gestionnaire.reqCompteurs();
+                                  if (prochain > nbColis && compteurs.missionsTerminees + compteurs.colisRefuses == nbColis)
+                                      break;
+                                  if (nbLances == 0 && nbTermines == 0)
+                                      this_thread::yield();
+                              }
+                          });
+    }
+    for (thread& fil : fils)
+        fil.join();
+    const auto fin = chrono::steady_clock::now();
+
+    Mesure mesure;
+    mesure.duree = chrono::duration<double>(fin - debut).count();
+    const StatistiquesFlotte compteurs = gestionnaire.reqCompteurs();
+    mesure.nbLivres = compteurs.missionsTerminees;
+    mesure.nbRefuses = compteurs.colisRefuses;
+    mesure.bilanExact = mesure.nbLivres + mesure.nbRefuses == nbColis
+                        && compteurs.dronesDisponibles == compteurs.nbDrones && compteurs.missionsEnCours == 0
+                        && compteurs.colisEnAttente == 0 && compteurs.colisDifferes == 0;
+    for (int id = 1; id <= p_nbDrones; ++id)
+        mesure.bilanExact = mesure.bilanExact && !gestionnaire.terminerMission(id);
+    return mesure;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 5)
+    {
+        cerr << "Utilisation : " << argv[0] << " [drones] [colis] [fils_max] [graine]" << endl;
+        return 2;
+    }
+    const int nbDrones = argc > 1 ? atoi(argv[1]) : 100000;
+    const int nbColis = argc > 2 ? atoi(argv[2]) : 1000000;
+    const size_t nbFilsMax = argc > 3 ? static_cast<size_t>(atoi(argv[3])) : 16;
+    const unsigned int graine = argc > 4 ? static_cast<unsigned int>(atoi(argv[4])) : 1u;
+    if (nbDrones <= 0 || nbColis <= 0 || nbFilsMax == 0)
+    {
+        cerr << "Erreur : drones, colis et fils_max doivent être positifs" << endl;
+        return 2;
+    }
+
+    // Un colis sur vingt environ dépasse les 2 kg du plus gros drone.
+    vector<double> poids(nbColis);
+    mt19937 generateur(graine);
+    uniform_real_distribution<double> loi(0.1, 2.1);
+    for (double& p : poids)
+        p = loi(generateur);
+
+    bool toutExact = true;
+    try
+    {
+        cout << "Coeurs : " << thread::hardware_concurrency() << ", drones : " << nbDrones
+             << ", colis : " << nbColis << "\n"
+             << "     fils  durée (s)  colis/s  accélération  livrés  refusés  bilan\n";
+        double reference = 0.0;
+        for (size_t nbFils = 1; nbFils <= nbFilsMax; nbFils *= 2)
+        {
+            const Mesure mesure = mesurer(nbFils, nbDrones, poids);
+            const double debit = (mesure.nbLivres + mesure.nbRefuses) / mesure.duree;
+            if (nbFils == 1)
+                reference = debit;
+            toutExact = toutExact && mesure.bilanExact;
+            cout << setw(9) << nbFils << fixed << setprecision(3) << setw(11) << mesure.duree
+                 << setprecision(0) << setw(9) << debit << setprecision(2) << setw(14) << debit / reference
+                 << setw(8) << mesure.nbLivres << setw(9) << mesure.nbRefuses << "  "
+                 << (mesure.bilanExact ? "ok" : "INCOHÉRENT") << endl;
+        }
+    }
+    catch (const exception& e)
+    {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    return toutExact ? 0 : 1;
+}
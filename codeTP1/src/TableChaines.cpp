@@ -0,0 +1,141 @@
+/**
+ * \file TableChaines.cpp
+ * \brief Implantation de la table des chaînes internées.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "TableChaines.h"
+#include "ContratException.h"
+
+using namespace std;
+
+namespace microdrone
+{
+
+const uint32_t TableChaines::VIDE;
+const size_t TableChaines::BITS_PREMIER_BLOC;
+const size_t TableChaines::NB_BLOCS;
+
+    /**
+     * \brief Constructeur : la chaîne vide reçoit l'identifiant VIDE.
+     */
+TableChaines::TableChaines():m_taille(0)
+{
+    for (atomic<string_view*>& bloc : m_blocs)
+        bloc.store(nullptr, memory_order_relaxed);
+    m_chaines.emplace_back();
+    m_indices.emplace(string_view(m_chaines.back()), VIDE);
+    publier(m_chaines.back());
+}
+
+    /**
+     * \brief Destructeur : libère les blocs de vues.
+     */
+TableChaines::~TableChaines()
+{
+    for (atomic<string_view*>& bloc : m_blocs)
+        delete[] bloc.load(memory_order_relaxed);
+}
+
+    /**
+     * \brief Retourne la table partagée par tout le processus.
+     *
+     * \return L'unique instance, créée au premier appel.
+     */
+TableChaines& TableChaines::instance()
+{
+    static TableChaines table;
+    return table;
+}
+
+    /**
+     * \brief Interne une chaîne.
+     *
+     * \param[in] p_chaine La chaîne à interner (copiée seulement si elle est nouvelle).
+     * \return L'identifiant de la chaîne, identique pour deux chaînes égales.
+     */
+uint32_t TableChaines::interner(string_view p_chaine)
+{
+    lock_guard<mutex> verrou(m_verrou);
+    auto it = m_indices.find(p_chaine);
+    if (it != m_indices.end())
+        return it->second;
+
+    uint32_t id = static_cast<uint32_t>(m_chaines.size());
+    m_chaines.emplace_back(p_chaine);
+    m_indices.emplace(string_view(m_chaines.back()), id);
+    publier(m_chaines.back());
+    return id;
+}
+
+    /**
+     * \brief Retourne la chaîne associée à un identifiant.
+     *
+     * Sans verrou : la lecture de m_taille (acquire) rend visible la vue
+     * écrite par interner avant la publication de l'identifiant.
+     *
+     * \param[in] p_id Un identifiant retourné par interner().
+     * \return Une vue valide jusqu'à la fin du programme.
+     *
+     * \pre p_id < reqTaille()
+     */
+string_view TableChaines::reqChaine(uint32_t p_id) const
+{
+    [[maybe_unused]] const uint32_t taille = m_taille.load(memory_order_acquire);
+    PRECONDITION(p_id < taille);
+    size_t position;
+    const size_t bloc = localiser(p_id, position);
+    return m_blocs[bloc].load(memory_order_relaxed)[position];
+}
+
+    /**
+     * \brief Retourne le nombre de chaînes distinctes, chaîne vide comprise.
+     */
+size_t TableChaines::reqTaille() const
+{
+    return m_taille.load(memory_order_acquire);
+}
+
+    /**
+     * \brief Situe un identifiant dans les blocs de vues.
+     *
+     * Le bloc k contient 2^(BITS_PREMIER_BLOC + k) vues, à partir de
+     * l'identifiant 2^(BITS_PREMIER_BLOC + k) - 2^BITS_PREMIER_BLOC.
+     *
+     * \param[in] p_id L'identifiant.
+     * \param[out] p_position La position de l'identifiant dans son bloc.
+     * \return Le numéro du bloc.
+     */
+size_t TableChaines::localiser(uint32_t p_id, size_t& p_position)
+{
+    const uint64_t decale = uint64_t(p_id) + (uint64_t(1) << BITS_PREMIER_BLOC);
+    const size_t exposant = 63u - static_cast<size_t>(__builtin_clzll(decale));
+    p_position = static_cast<size_t>(decale - (uint64_t(1) << exposant));
+    return exposant - BITS_PREMIER_BLOC;
+}
+
+    /**
+     * \brief Range la vue de l'identifiant reqTaille() puis le publie.
+     *
+     * Appelée sous m_verrou (ou par le constructeur) : un seul écrivain à la
+     * fois. Un bloc est alloué au premier identifiant qui y tombe.
+     *
+     * \param[in] p_chaine La chaîne, qui doit appartenir à m_chaines.
+     */
+void TableChaines::publier(string_view p_chaine)
+{
+    const uint32_t id = m_taille.load(memory_order_relaxed);
+    size_t position;
+    const size_t bloc = localiser(id, position);
+    string_view* vues = m_blocs[bloc].load(memory_order_relaxed);
+    if (vues == nullptr)
+    {
+        vues = new string_view[size_t(1) << (BITS_PREMIER_BLOC + bloc)];
+        m_blocs[bloc].store(vues, memory_order_relaxed);
+    }
+    vues[position] = p_chaine;
+    m_taille.store(id + 1, memory_order_release);
+}
+
+} // namespace microdrone
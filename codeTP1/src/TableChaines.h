@@ -0,0 +1,92 @@
+/**
+ * \file TableChaines.h
+ * \brief Déclaration de la table des chaînes internées.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#ifndef TABLECHAINES_H_DEJA_INCLU
+#define TABLECHAINES_H_DEJA_INCLU
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace microdrone
+{
+
+/**
+ * \class TableChaines
+ * \brief Table unique au processus qui conserve une seule copie de chaque chaîne.
+ *
+ * Les destinations des colis et les modèles des drones se répètent énormément;
+ * chaque objet ne garde donc qu'un identifiant compact de 32 bits. Les chaînes
+ * ne sont jamais retirées : les vues retournées restent valides jusqu'à la fin
+ * du programme.
+ *
+ * Seul interner prend le verrou. Les lectures (reqChaine, reqTaille) sont sans
+ * verrou : les vues sont rangées par identifiant dans des blocs de taille
+ * doublante qui ne sont jamais déplacés, et m_taille n'est publiée qu'une fois
+ * la vue du nouvel identifiant écrite.
+ */
+class TableChaines
+{
+public:
+    static const std::uint32_t VIDE = 0; //!< Identifiant réservé à la chaîne vide.
+
+    /**
+     * \brief Retourne la table du processus.
+     */
+    static TableChaines& instance();
+
+    /**
+     * \brief Retourne l'identifiant d'une chaîne, en l'ajoutant au besoin.
+     */
+    std::uint32_t interner(std::string_view p_chaine);
+
+    /**
+     * \brief Retourne la chaîne associée à un identifiant.
+     */
+    std::string_view reqChaine(std::uint32_t p_id) const;
+
+    /**
+     * \brief Retourne le nombre de chaînes distinctes conservées.
+     */
+    std::size_t reqTaille() const;
+
+    TableChaines(const TableChaines&) = delete;
+    TableChaines& operator=(const TableChaines&) = delete;
+    ~TableChaines();
+
+private:
+    static const std::size_t BITS_PREMIER_BLOC = 10;                //!< Le bloc 0 contient 1024 vues.
+    static const std::size_t NB_BLOCS = 32 - BITS_PREMIER_BLOC + 1; //!< De quoi couvrir 2^32 identifiants.
+
+    TableChaines();
+
+    /**
+     * \brief Retourne le bloc d'un identifiant et sa position dans ce bloc.
+     */
+    static std::size_t localiser(std::uint32_t p_id, std::size_t& p_position);
+
+    /**
+     * \brief Range la vue du prochain identifiant puis publie la nouvelle taille.
+     */
+    void publier(std::string_view p_chaine);
+
+    std::mutex m_verrou;                                            //!< Sérialise interner.
+    std::deque<std::string> m_chaines;                              //!< Chaînes, adresses stables (sous m_verrou).
+    std::unordered_map<std::string_view, std::uint32_t> m_indices;  //!< Chaîne → identifiant (sous m_verrou).
+    std::array<std::atomic<std::string_view*>, NB_BLOCS> m_blocs;   //!< Vues par identifiant, bloc k de 2^(10+k).
+    std::atomic<std::uint32_t> m_taille;                            //!< Identifiants publiés.
+};
+
+} // namespace microdrone
+
+#endif // TABLECHAINES_H_DEJA_INCLU
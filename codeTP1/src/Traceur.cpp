@@ -0,0 +1,285 @@
+/**
+ * \file Traceur.cpp
+ * \brief Implantation du traceur de portées.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ */
+#include "Traceur.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+namespace microdrone
+{
+
+namespace
+{
+const size_t EVENEMENTS_PAR_BLOC = 4096;
+
+struct EvenementTrace
+{
+    const char* nom;
+    int64_t instant;    // Nanosecondes de l'horloge monotone.
+    char phase;         // 'B' (début) ou 'E' (fin).
+};
+
+// Bloc d'un tampon de fil. Seul le fil propriétaire écrit; nb et suivant
+// sont publiés avec release pour qu'une exportation concurrente ne lise que
+// des événements complets.
+struct BlocTrace
+{
+    array<EvenementTrace, EVENEMENTS_PAR_BLOC> evenements;
+    atomic<size_t> nb{0};
+    atomic<BlocTrace*> suivant{nullptr};
+};
+
+struct TamponFil
+{
+    explicit TamponFil(uint32_t p_idFil):idFil(p_idFil), premier(new BlocTrace), courant(premier.get()),
+        nbBlocs(1), libre(false)
+    {
+    }
+
+    ~TamponFil()
+    {
+        libererSuivants();
+    }
+
+    void libererSuivants()
+    {
+        BlocTrace* bloc = premier->suivant.exchange(nullptr);
+        while (bloc != nullptr)
+        {
+            BlocTrace* suivant = bloc->suivant.load();
+            delete bloc;
+            bloc = suivant;
+        }
+    }
+
+    uint32_t idFil;
+    unique_ptr<BlocTrace> premier;
+    BlocTrace* courant;         // Bloc où écrit le fil propriétaire.
+    size_t nbBlocs;             // Blocs chaînés, au plus Traceur::MAX_BLOCS_PAR_FIL.
+    atomic<size_t> nbPerdus{0}; // Événements abandonnés, tampon plein.
+    bool libre;                 // Fil propriétaire terminé (sous Registre::verrou).
+};
+
+struct Registre
+{
+    mutex verrou;
+    vector<unique_ptr<TamponFil>> tampons;
+};
+
+Registre& registre()
+{
+    static Registre instance;
+    return instance;
+}
+
+thread_local TamponFil* t_tampon = nullptr;
+
+// Rend le tampon du fil au registre quand le fil se termine. Distinct de
+// t_tampon, dont la lecture reste un simple accès, sans garde d'initialisation.
+struct AttacheFil
+{
+    ~AttacheFil()
+    {
+        if (tampon == nullptr)
+            return;
+        Registre& r = registre();
+        lock_guard<mutex> verrou(r.verrou);
+        tampon->libre = true;
+        t_tampon = nullptr;
+    }
+
+    TamponFil* tampon = nullptr;
+};
+
+thread_local AttacheFil t_attache;
+
+TamponFil& tamponDuFil()
+{
+    if (t_tampon == nullptr)
+    {
+        Registre& r = registre();
+        lock_guard<mutex> verrou(r.verrou);
+        auto libre = find_if(r.tampons.begin(), r.tampons.end(),
+                             [](const unique_ptr<TamponFil>& p_tampon) { return p_tampon->libre; });
+        if (libre == r.tampons.end())
+        {
+            r.tampons.push_back(make_unique<TamponFil>(static_cast<uint32_t>(r.tampons.size() + 1)));
+            libre = r.tampons.end() - 1;
+        }
+        (*libre)->libre = false;
+        t_tampon = libre->get();
+        t_attache.tampon = t_tampon;
+    }
+    return *t_tampon;
+}
+
+void enregistrer(const char* p_nom, char p_phase)
+{
+    const int64_t instant = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count();
+    TamponFil& tampon = tamponDuFil();
+    BlocTrace* bloc = tampon.courant;
+    size_t nb = bloc->nb.load(memory_order_relaxed);
+    if (nb == EVENEMENTS_PAR_BLOC)
+    {
+        if (tampon.nbBlocs == Traceur::MAX_BLOCS_PAR_FIL)
+        {
+            tampon.nbPerdus.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+        tampon.nbBlocs++;
+        BlocTrace* nouveau = new BlocTrace;
+        bloc->suivant.store(nouveau, memory_order_release);
+        tampon.courant = bloc = nouveau;
+        nb = 0;
+    }
+    bloc->evenements[nb] = EvenementTrace{p_nom, instant, p_phase};
+    bloc->nb.store(nb + 1, memory_order_release);
+}
+
+void ecrireChaineJson(ostream& p_flux, const char* p_texte)
+{
+    p_flux << '"';
+    for (const char* c = p_texte; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+            p_flux << '\\';
+        p_flux << *c;
+    }
+    p_flux << '"';
+}
+}
+
+const size_t Traceur::MAX_BLOCS_PAR_FIL = 64;
+
+void Traceur::debuter(const char* p_nom)
+{
+    enregistrer(p_nom, 'B');
+}
+
+void Traceur::terminer(const char* p_nom)
+{
+    enregistrer(p_nom, 'E');
+}
+
+    /**
+     * \brief Écrit les événements de tous les fils en JSON « trace event ».
+     *
+     * Les instants sont en microsecondes depuis le premier événement de la
+     * trace; chaque fil garde son numéro d'enregistrement comme tid. Peut être
+     * appelé pendant que d'autres fils tracent : seuls les événements déjà
+     * publiés sont écrits.
+     *
+     * \param[out] p_flux Le flux qui reçoit la trace.
+     */
+void Traceur::exporter(ostream& p_flux)
+{
+    Registre& r = registre();
+    lock_guard<mutex> verrou(r.verrou);
+
+    int64_t origine = numeric_limits<int64_t>::max();
+    for (const unique_ptr<TamponFil>& tampon : r.tampons)
+    {
+        if (tampon->premier->nb.load(memory_order_acquire) > 0)
+            origine = min(origine, tampon->premier->evenements[0].instant);
+    }
+
+    p_flux << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    const char* separateur = "\n";
+    p_flux << fixed << setprecision(3);
+    for (const unique_ptr<TamponFil>& tampon : r.tampons)
+    {
+        for (const BlocTrace* bloc = tampon->premier.get(); bloc != nullptr;
+             bloc = bloc->suivant.load(memory_order_acquire))
+        {
+            const size_t nb = bloc->nb.load(memory_order_acquire);
+            for (size_t i = 0; i < nb; ++i)
+            {
+                const EvenementTrace& evenement = bloc->evenements[i];
+                p_flux << separateur << "{\"name\": ";
+                ecrireChaineJson(p_flux, evenement.nom);
+                p_flux << ", \"ph\": \"" << evenement.phase << "\", \"ts\": "
+                       << static_cast<double>(evenement.instant - origine) / 1e3
+                       << ", \"pid\": 1, \"tid\": " << tampon->idFil << "}";
+                separateur = ",\n";
+            }
+        }
+    }
+    p_flux << "\n]}" << endl;
+}
+
+    /**
+     * \brief Écrit la trace dans un fichier, remplacé s'il existe.
+     *
+     * \param[in] p_nomFichier Le fichier de destination, par exemple trace.json.
+     *
+     * \throw runtime_error si le fichier ne peut pas être ouvert.
+     */
+void Traceur::exporter(const string& p_nomFichier)
+{
+    ofstream fichier(p_nomFichier);
+    if (!fichier)
+        throw runtime_error("Impossible d'ouvrir le fichier " + p_nomFichier);
+    exporter(fichier);
+}
+
+    /**
+     * \brief Oublie tous les événements enregistrés et libère les blocs supplémentaires.
+     *
+     * \pre Aucun autre fil ne trace pendant l'appel.
+     */
+void Traceur::vider()
+{
+    Registre& r = registre();
+    lock_guard<mutex> verrou(r.verrou);
+    for (const unique_ptr<TamponFil>& tampon : r.tampons)
+    {
+        tampon->libererSuivants();
+        tampon->premier->nb.store(0, memory_order_relaxed);
+        tampon->courant = tampon->premier.get();
+        tampon->nbBlocs = 1;
+        tampon->nbPerdus.store(0, memory_order_relaxed);
+    }
+}
+
+size_t Traceur::reqNbEvenements()
+{
+    Registre& r = registre();
+    lock_guard<mutex> verrou(r.verrou);
+    size_t total = 0;
+    for (const unique_ptr<TamponFil>& tampon : r.tampons)
+    {
+        for (const BlocTrace* bloc = tampon->premier.get(); bloc != nullptr;
+             bloc = bloc->suivant.load(memory_order_acquire))
+            total += bloc->nb.load(memory_order_acquire);
+    }
+    return total;
+}
+
+size_t Traceur::reqNbEvenementsPerdus()
+{
+    Registre& r = registre();
+    lock_guard<mutex> verrou(r.verrou);
+    size_t total = 0;
+    for (const unique_ptr<TamponFil>& tampon : r.tampons)
+        total += tampon->nbPerdus.load(memory_order_relaxed);
+    return total;
+}
+
+} // namespace microdrone
@@ -0,0 +1,115 @@
+/**
+ * \file Traceur.h
+ * \brief Déclaration du traceur de portées et des macros TRACER_PORTEE.
+ * \author Ladouceur Noah
+ * \version 0.1
+ * \date Mai 2025
+ *
+ * Le traçage n'est compilé que si FLOTTE_TRACAGE est défini (option CMake
+ * du même nom); sinon TRACER_PORTEE ne produit aucun code. Les fonctions
+ * d'exportation restent disponibles dans les deux cas et écrivent alors une
+ * trace vide.
+ */
+#ifndef TRACEUR_H_DEJA_INCLU
+#define TRACEUR_H_DEJA_INCLU
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace microdrone
+{
+
+/**
+ * \class Traceur
+ * \brief Enregistre des débuts et fins de portées par fil et les exporte au
+ *        format « trace event » de Chrome (chrome://tracing, Perfetto).
+ *
+ * Chaque fil écrit dans son propre tampon, alloué par blocs à sa première
+ * trace : enregistrer un événement ne prend aucun verrou, seulement une
+ * lecture de l'horloge monotone et une écriture dans le bloc courant. Les
+ * tampons survivent à leur fil, de sorte qu'une trace peut être exportée
+ * après la fin des fils de chargement; le tampon d'un fil terminé est repris
+ * par le prochain fil qui trace, qui y poursuit sous le même tid. Un tampon
+ * compte au plus MAX_BLOCS_PAR_FIL blocs : au-delà, les événements du fil
+ * sont perdus et comptés (reqNbEvenementsPerdus). Les noms doivent être des
+ * chaînes de durée de vie statique (littéraux), qui ne sont pas copiées.
+ */
+class Traceur
+{
+public:
+    static const std::size_t MAX_BLOCS_PAR_FIL;  //!< Blocs de 4096 événements par tampon.
+
+    /**
+     * \brief Enregistre le début d'une portée dans le tampon du fil appelant.
+     */
+    static void debuter(const char* p_nom);
+
+    /**
+     * \brief Enregistre la fin d'une portée dans le tampon du fil appelant.
+     */
+    static void terminer(const char* p_nom);
+
+    /**
+     * \brief Écrit les événements de tous les fils en JSON « trace event ».
+     */
+    static void exporter(std::ostream& p_flux);
+
+    /**
+     * \brief Écrit la trace dans un fichier, remplacé s'il existe.
+     */
+    static void exporter(const std::string& p_nomFichier);
+
+    /**
+     * \brief Oublie tous les événements enregistrés.
+     */
+    static void vider();
+
+    /**
+     * \brief Retourne le nombre d'événements enregistrés, tous fils confondus.
+     */
+    static std::size_t reqNbEvenements();
+
+    /**
+     * \brief Retourne le nombre d'événements perdus, tampons pleins, tous fils confondus.
+     */
+    static std::size_t reqNbEvenementsPerdus();
+};
+
+/**
+ * \class PorteeTrace
+ * \brief Enregistre le début d'une portée à sa construction et sa fin à sa destruction.
+ */
+class PorteeTrace
+{
+public:
+    explicit PorteeTrace(const char* p_nom):m_nom(p_nom)
+    {
+        Traceur::debuter(m_nom);
+    }
+
+    ~PorteeTrace()
+    {
+        Traceur::terminer(m_nom);
+    }
+
+    PorteeTrace(const PorteeTrace&) = delete;
+    PorteeTrace& operator=(const PorteeTrace&) = delete;
+
+private:
+    const char* m_nom;  //!< Nom de la portée, de durée de vie statique.
+};
+
+} // namespace microdrone
+
+#define TRACEUR_CONCATENER_(a, b) a##b
+#define TRACEUR_CONCATENER(a, b) TRACEUR_CONCATENER_(a, b)
+
+#if defined(FLOTTE_TRACAGE)
+#define TRACER_PORTEE(p_nom) \
+      ::microdrone::PorteeTrace TRACEUR_CONCATENER(porteeTrace, __LINE__)(p_nom)
+#else
+#define TRACER_PORTEE(p_nom) ((void)0)
+#endif
+
+#endif // TRACEUR_H_DEJA_INCLU